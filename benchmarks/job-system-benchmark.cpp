@@ -0,0 +1,70 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "jobs/job-system.hpp"
+
+using namespace TWE;
+using Clock = std::chrono::high_resolution_clock;
+
+double getElapsed(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+double measureEmptyJobs(int jobCount) {
+    std::vector<JobHandle> jobs;
+    jobs.reserve(jobCount);
+    auto start = Clock::now();
+    for(int i = 0; i < jobCount; ++i)
+        jobs.push_back(JobSystem::submit([]() {}));
+    JobSystem::wait(jobs);
+    return getElapsed(start) * 1000000.0 / jobCount;
+}
+
+double measureDependencyChain(int jobCount) {
+    auto start = Clock::now();
+    JobHandle previous;
+    for(int i = 0; i < jobCount; ++i)
+        previous = JobSystem::submit([]() {}, { previous });
+    JobSystem::wait(previous);
+    return getElapsed(start) * 1000000.0 / jobCount;
+}
+
+double measureParallelFor(std::vector<float>& values, size_t grainSize) {
+    auto start = Clock::now();
+    JobSystem::parallelFor(values.size(), grainSize, [&](size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i)
+            values[i] = std::sqrt(std::sin(values[i]) * std::sin(values[i]) + 1.f);
+    });
+    return getElapsed(start);
+}
+
+int main() {
+    const int jobCount = 100000;
+    const size_t elementCount = 1 << 24;
+    const size_t grainSize = 16384;
+    uint32_t maxWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    std::vector<float> values(elementCount, 1.f);
+    double baseline = 0.0;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "threads | empty job, ns | chained job, ns | parallelFor " << elementCount << " elements, ms | speedup\n";
+    std::vector<uint32_t> workerCounts;
+    for(uint32_t threadCount = 1; threadCount - 1 < maxWorkers; threadCount *= 2)
+        workerCounts.push_back(threadCount - 1);
+    workerCounts.push_back(maxWorkers);
+    for(auto workerCount : workerCounts) {
+        JobSystem::init(workerCount);
+        measureParallelFor(values, grainSize);
+        double emptyJob = measureEmptyJobs(jobCount);
+        double chainedJob = measureDependencyChain(jobCount);
+        double parallelFor = measureParallelFor(values, grainSize);
+        if(workerCount == 0)
+            baseline = parallelFor;
+        std::cout << std::setw(7) << workerCount + 1 << " | " << std::setw(13) << emptyJob << " | " << std::setw(15) << chainedJob << " | "
+            << std::setw(30) << parallelFor << " | " << baseline / parallelFor << "x\n";
+        JobSystem::shutdown();
+    }
+    return 0;
+}
\ No newline at end of file
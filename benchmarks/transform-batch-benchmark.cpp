@@ -0,0 +1,71 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "scene/transform-batch.hpp"
+
+using namespace TWE;
+using Clock = std::chrono::high_resolution_clock;
+
+double getElapsed(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void invalidate(std::vector<TransformComponent>& transforms) {
+    for(auto& transformComponent : transforms)
+        transformComponent.setSize(transformComponent.getSize());
+}
+
+double measureScalar(std::vector<TransformComponent>& transforms, int iterations) {
+    double elapsed = 0.0;
+    float checksum = 0.f;
+    for(int i = 0; i < iterations; ++i) {
+        invalidate(transforms);
+        auto start = Clock::now();
+        for(auto& transformComponent : transforms)
+            checksum += transformComponent.getModel()[3][0];
+        elapsed += getElapsed(start);
+    }
+    if(checksum == -1.f)
+        std::cout << checksum;
+    return elapsed * 1000000.0 / (static_cast<double>(iterations) * transforms.size());
+}
+
+double measureBatch(std::vector<TransformComponent>& transforms, int iterations) {
+    double elapsed = 0.0;
+    for(int i = 0; i < iterations; ++i) {
+        invalidate(transforms);
+        auto start = Clock::now();
+        for(auto& transformComponent : transforms)
+            TransformBatch::submit(transformComponent);
+        TransformBatch::compute();
+        elapsed += getElapsed(start);
+    }
+    return elapsed * 1000000.0 / (static_cast<double>(iterations) * transforms.size());
+}
+
+int main() {
+    const int iterations = 50;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> positions(-100.f, 100.f);
+    std::uniform_real_distribution<float> angles(-3.14f, 3.14f);
+    std::uniform_real_distribution<float> sizes(0.1f, 10.f);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "transforms | getModel, ns | TransformBatch, ns | speedup\n";
+    for(size_t transformCount : { 1000, 10000, 100000, 1000000 }) {
+        std::vector<TransformComponent> transforms(transformCount);
+        for(auto& transformComponent : transforms) {
+            transformComponent.setPosition({ positions(random), positions(random), positions(random) });
+            transformComponent.setRotation({ angles(random), angles(random), angles(random) });
+            transformComponent.setSize({ sizes(random), sizes(random), sizes(random) });
+        }
+        measureBatch(transforms, 1);
+        double scalar = measureScalar(transforms, iterations);
+        double batch = measureBatch(transforms, iterations);
+        std::cout << std::setw(10) << transformCount << " | " << std::setw(12) << scalar << " | " << std::setw(18) << batch << " | "
+            << scalar / batch << "x\n";
+    }
+    return 0;
+}
\ No newline at end of file
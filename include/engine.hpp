@@ -5,6 +5,7 @@
 #include <string>
 #include <cstdlib>
 #include <memory>
+#include <functional>
 #include <glad.h>
 #include <glfw3.h>
 #define GLFW_EXPOSE_NATIVE_WIN32
@@ -15,9 +16,19 @@
 
 #include "math.h"
 #include "scene/shape.hpp"
+#include "scene/asset-manager.hpp"
 #include "scene/scene.hpp"
 #include "scene/time.hpp"
+#include "renderer/upload-manager.hpp"
+#include "renderer/texture-streamer.hpp"
+#include "renderer/shader-cache.hpp"
+#include "renderer/renderer-2d.hpp"
+#include "renderer/deferred-renderer.hpp"
+#include "renderer/render-target-pool.hpp"
+#include "renderer/dynamic-resolution.hpp"
+#include "renderer/render-thread.hpp"
 #include "model-loader/model-loader.hpp"
+#include "jobs/job-system.hpp"
 #include "entity/entity.hpp"
 #include "input/window.hpp"
 #include "input/input.hpp"
@@ -57,7 +68,11 @@ namespace TWE {
         static std::unique_ptr<GUI> gui;
         #else
         void loadBuild(const std::string& buildFilePath);
+        void startPipelined();
+        void renderFrame(int frameIndex);
+        void renderScaled(const std::function<void()>& renderScene);
         static std::unique_ptr<UIBuild> uiBuild;
+        static std::unique_ptr<RenderThread> renderThread;
         #endif
     };
 }
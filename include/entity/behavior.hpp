@@ -2,12 +2,14 @@
 #define BEHAVIOR_HPP
 
 #include <string>
+#include <vector>
 #include <filesystem>
 #include <glm.hpp>
 #include <btBulletDynamicsCommon.h>
 #include "imgui.h"
 
 #include "entity.hpp"
+#include "command-buffer.hpp"
 #include "input/input.hpp"
 #include "scene/shape-specification.hpp"
 
@@ -26,8 +28,22 @@ namespace TWE {
         T* addComponent(Args&&... args);
         template<typename T>
         void removeComponent();
+        template<typename T, typename ...Args>
+        void addComponentDeferred(Args&&... args);
+        template<typename T>
+        void removeComponentDeferred();
         template<typename T = void>
         void destroy();
+        template<typename T = void>
+        CommandBuffer* getCommandBuffer();
+        template<typename T = void>
+        Entity findEntity(int id);
+        template<typename T = void>
+        Entity findEntity(const std::string& name);
+        template<typename T = void>
+        std::vector<Entity> findEntities(const std::string& name);
+        template<typename T = void>
+        void setName(const std::string& name);
         void loadScene(const std::filesystem::path& scenePath) { 
            loadScenePath = scenePath;
            needLoadScene = true;
@@ -92,9 +108,53 @@ namespace TWE {
         gameObject.removeComponent<T>();
     }
 
+    template<typename T, typename ...Args>
+    void Behavior::addComponentDeferred(Args&&... args) {
+        getCommandBuffer()->addComponent<T>(gameObject, std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void Behavior::removeComponentDeferred() {
+        getCommandBuffer()->removeComponent<T>(gameObject);
+    }
+
     template<typename T>
     void Behavior::destroy() {
-        gameObject.destroy();
+        getCommandBuffer()->destroy(gameObject);
+    }
+
+    template<typename T>
+    CommandBuffer* Behavior::getCommandBuffer() {
+        return gameObject.getScene()->getCommandBuffer();
+    }
+
+    template<typename T>
+    Entity Behavior::findEntity(int id) {
+        auto scene = gameObject.getScene();
+        entt::entity entity = scene->getSceneStateSpecification()->entityIndex.findById(id);
+        return entity == entt::null ? Entity{} : Entity{ entity, scene };
+    }
+
+    template<typename T>
+    Entity Behavior::findEntity(const std::string& name) {
+        auto scene = gameObject.getScene();
+        entt::entity entity = scene->getSceneStateSpecification()->entityIndex.findByName(name);
+        return entity == entt::null ? Entity{} : Entity{ entity, scene };
+    }
+
+    template<typename T>
+    std::vector<Entity> Behavior::findEntities(const std::string& name) {
+        auto scene = gameObject.getScene();
+        std::vector<Entity> res;
+        for(auto entity : scene->getSceneStateSpecification()->entityIndex.findAllByName(name))
+            res.emplace_back(entity, scene);
+        return res;
+    }
+
+    template<typename T>
+    void Behavior::setName(const std::string& name) {
+        getComponent<NameComponent>()->setName(name);
+        gameObject.patchComponent<NameComponent>();
     }
 }
 
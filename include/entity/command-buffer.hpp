@@ -0,0 +1,78 @@
+#ifndef COMMAND_BUFFER_HPP
+#define COMMAND_BUFFER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+
+#include "entity/entity.hpp"
+#include "jobs/job-system.hpp"
+#include "scene/components/id-component.hpp"
+
+namespace TWE {
+    struct CreateCommandSpecification {
+        std::string name;
+        std::function<void(Entity&)> onCreate;
+    };
+
+    struct ComponentCommandSpecification {
+        entt::id_type type;
+        entt::entity entity;
+        std::function<void(entt::registry&, entt::entity)> apply;
+    };
+
+    struct CommandQueueSpecification {
+        std::mutex mutex;
+        std::vector<CreateCommandSpecification> creates;
+        std::vector<ComponentCommandSpecification> adds;
+        std::vector<ComponentCommandSpecification> removes;
+        std::vector<entt::entity> destroys;
+    };
+
+    class CommandBuffer {
+    public:
+        CommandBuffer(IScene* scene);
+        void createEntity(const std::string& name = "Entity", const std::function<void(Entity&)>& onCreate = {});
+        void destroy(const Entity& entity);
+        template<typename T, typename ...Args>
+        void addComponent(const Entity& entity, Args&&... args);
+        template<typename T>
+        void removeComponent(const Entity& entity);
+        void execute();
+        void clear();
+    private:
+        [[nodiscard]] CommandQueueSpecification& getQueue();
+        void merge();
+        void executeComponentCommands(entt::registry& registry, std::vector<ComponentCommandSpecification>& commands);
+        IScene* _scene;
+        std::vector<std::unique_ptr<CommandQueueSpecification>> _queues;
+        CommandQueueSpecification _commands;
+    };
+
+    template<typename T, typename ...Args>
+    void CommandBuffer::addComponent(const Entity& entity, Args&&... args) {
+        auto& queue = getQueue();
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.adds.push_back({ entt::type_hash<T>::value(), entity.getSource(),
+            [arguments = std::make_tuple(std::forward<Args>(args)...)](entt::registry& registry, entt::entity source) {
+                std::apply([&](const auto&... values) { registry.emplace_or_replace<T>(source, values...); }, arguments);
+            } });
+    }
+
+    template<typename T>
+    void CommandBuffer::removeComponent(const Entity& entity) {
+        auto& queue = getQueue();
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.removes.push_back({ entt::type_hash<T>::value(), entity.getSource(), [](entt::registry& registry, entt::entity source) {
+            if(registry.any_of<T>(source))
+                registry.remove<T>(source);
+        } });
+    }
+}
+
+#endif
\ No newline at end of file
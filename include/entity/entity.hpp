@@ -22,6 +22,9 @@ namespace TWE {
         template<typename T>
         void removeComponent();
 
+        template<typename T>
+        void patchComponent();
+
         template<typename T = void>
         void destroy();
 
@@ -69,6 +72,16 @@ namespace TWE {
         _scene->getSceneRegistry()->current->entityRegistry.remove<T>(_entity);
     }
 
+    template<typename T>
+    void Entity::patchComponent() {
+        if(!hasComponent<T>()) {
+            std::string componentName = typeid(T).name();
+            componentName = componentName.substr(6);
+            throw std::runtime_error("Error: A " + componentName + " was not found.");
+        }
+        _scene->getSceneRegistry()->current->entityRegistry.patch<T>(_entity);
+    }
+
     template<typename T>
     void Entity::destroy() {
         _scene->cleanEntity(*this);
@@ -15,6 +15,7 @@ namespace TWE {
     public:
         static bool dragFloat3(const std::string& label, glm::vec3& values, float step, float resetValue, float min = 0.f, float max = 0.f, float labelColumnWidth = 80.f);
         static bool dragFloat(const std::string& label, float& value, float step, float min = 0.f, float max = 0.f, float labelColumnWidth = 80.f);
+        static bool dragFloat4(const std::string& label, glm::vec4& values, float step, float min = 0.f, float max = 0.f, float labelColumnWidth = 80.f);
         static bool colorEdit3(const std::string& label, glm::vec3& values, float labelColumnWidth = 80.f);
         static bool checkBox(const std::string& label, bool& value, float labelColumnWidth = 80.f);
         static bool inputAndButton(const std::string& label, std::string& value, const std::string& buttonLabel, float labelColumnWidth = 80.f);
@@ -8,10 +8,12 @@
 
 #include "stream/script-creator.hpp"
 #include "stream/project-creator.hpp"
+#include "stream/directory-model.hpp"
 
 #include "gui/gui-components.hpp"
 #include "gui/gui-types.hpp"
 #include "gui/igui-panel.hpp"
+#include "gui/gui-thumbnail-cache.hpp"
 
 #include "renderer/texture.hpp"
 
@@ -22,7 +24,7 @@
 #include <vector>
 #include <algorithm>
 #include <filesystem>
-#include <algorithm>
+#include <map>
 
 namespace TWE {
     class GUIDirectoryPanel: public IGUIPanel {
@@ -34,16 +36,23 @@ namespace TWE {
         void setRootPath(std::filesystem::path& rootPath);
         void loadScene(std::filesystem::path& scenePath);
         void loadTextures();
+        void updateDirectoryModel();
+        void reimportAsset(const std::filesystem::path& path);
+        void reimportTextures(const std::filesystem::path& texturePath);
         void showDirectoryMenuPopup(const std::string& popupId);
         void showDirectoryFileMenuPopup(const std::string& popupId, std::filesystem::path& filePath);
         bool renderContent();
         std::filesystem::path _curPath;
         std::filesystem::path _rootPath;
+        DirectoryModel _directoryModel;
+        GUIThumbnailCache _thumbnailCache;
+        std::map<std::filesystem::path, int> _pendingImports;
         Texture* _dirTexture;
         Texture* _fileTexture;
         std::string _dirImgPath;
         std::string _fileImgPath;
         GUIStateSpecification* _guiState;
+        static const int importDelay;
     };
 }
 
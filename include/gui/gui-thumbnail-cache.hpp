@@ -0,0 +1,82 @@
+#ifndef GUI_THUMBNAIL_CACHE_HPP
+#define GUI_THUMBNAIL_CACHE_HPP
+
+#include <glad.h>
+#include <stb_image.h>
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <filesystem>
+#include <cstdint>
+#include <cstring>
+#include <cfloat>
+#include <cmath>
+
+#include "model-loader/model-loader.hpp"
+#include "renderer/upload-manager.hpp"
+#include "jobs/job-system.hpp"
+#include "stream/mapped-file.hpp"
+
+namespace TWE {
+    struct GUIThumbnailHeaderSpecification {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t size = 0;
+        uint32_t reserved = 0;
+    };
+
+    struct GUIThumbnailSpecification {
+        GUIThumbnailSpecification() = default;
+        JobHandle loadingJob;
+        std::shared_ptr<std::vector<uint8_t>> loadedPixels;
+        std::vector<uint8_t> pixels;
+        uint32_t texture = 0;
+        uint64_t lastUsedFrame = 0;
+        bool isFailed = false;
+        bool isStale = false;
+    };
+
+    class GUIThumbnailCache {
+    public:
+        GUIThumbnailCache() = default;
+        GUIThumbnailCache(const GUIThumbnailCache&) = delete;
+        GUIThumbnailCache& operator=(const GUIThumbnailCache&) = delete;
+        ~GUIThumbnailCache();
+        void update();
+        void invalidate(const std::filesystem::path& path);
+        void clear();
+        [[nodiscard]] uint32_t getThumbnail(const std::filesystem::path& path);
+        [[nodiscard]] static bool hasThumbnail(const std::filesystem::path& path);
+        static const int thumbnailSize;
+        static const int maxLoads;
+        static const int maxUploadsPerFrame;
+        static const uint64_t evictionDelay;
+        static const std::filesystem::path cachePath;
+        static const uint32_t magic;
+        static const uint32_t version;
+    private:
+        [[nodiscard]] static std::vector<uint8_t> generate(const std::filesystem::path& path);
+        [[nodiscard]] static std::vector<uint8_t> generateImageThumbnail(const std::filesystem::path& path);
+        [[nodiscard]] static std::vector<uint8_t> generateModelThumbnail(const std::filesystem::path& path);
+        [[nodiscard]] static std::vector<uint8_t> resize(const uint8_t* pixels, int width, int height, int size);
+        [[nodiscard]] static bool readCache(const std::filesystem::path& cacheFilePath, std::vector<uint8_t>& pixels);
+        static void writeCache(const std::filesystem::path& cacheFilePath, const std::vector<uint8_t>& pixels);
+        [[nodiscard]] static uint64_t hashFile(const std::filesystem::path& path);
+        [[nodiscard]] static std::string getExtension(const std::filesystem::path& path);
+        void release(GUIThumbnailSpecification& thumbnail);
+        std::map<std::filesystem::path, GUIThumbnailSpecification> _thumbnails;
+        int _loads = 0;
+        int _uploads = 0;
+        uint64_t _frame = 0;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "scene/iscene.hpp"
 #include "input/window.hpp"
+#include "renderer/dynamic-resolution.hpp"
 
 #include "gui/igui-panel.hpp"
 
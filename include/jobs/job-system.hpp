@@ -0,0 +1,110 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+
+namespace TWE {
+    enum class JobAffinity {
+        Any,
+        MainThread
+    };
+
+    class Job {
+    public:
+        Job(const std::function<void()>& task, JobAffinity affinity);
+        [[nodiscard]] bool isDone() const noexcept;
+        [[nodiscard]] JobAffinity getAffinity() const noexcept;
+    private:
+        std::function<void()> _task;
+        JobAffinity _affinity;
+        std::atomic<int> _pendingDependencies;
+        std::atomic<bool> _isDone;
+        std::mutex _continuationsMutex;
+        std::vector<std::shared_ptr<Job>> _continuations;
+        friend class JobSystem;
+    };
+
+    using JobHandle = std::shared_ptr<Job>;
+
+    struct JobQueueSpecification {
+        std::mutex mutex;
+        std::deque<JobHandle> jobs;
+    };
+
+    class JobSystem {
+    public:
+        static void init(uint32_t workerCount = 0);
+        static void shutdown();
+        static JobHandle submit(const std::function<void()>& task, const std::vector<JobHandle>& dependencies = {}, JobAffinity affinity = JobAffinity::Any);
+        static void wait(const JobHandle& job);
+        static void wait(const std::vector<JobHandle>& jobs);
+        static void executeMainThreadJobs();
+        static void runOnMainThread(const std::function<void()>& task);
+        static void setMainThread();
+        template<typename Func>
+        static void parallelFor(size_t count, size_t grainSize, const Func& func);
+        template<typename View, typename Func>
+        static void parallelForEach(const View& view, size_t grainSize, const Func& func);
+        [[nodiscard]] static uint32_t getWorkerCount() noexcept;
+        [[nodiscard]] static bool isMainThread() noexcept;
+        [[nodiscard]] static int getThreadIndex() noexcept;
+    private:
+        static void workerLoop(uint32_t index);
+        static void schedule(const JobHandle& job);
+        static void execute(const JobHandle& job);
+        static bool executeNext();
+        static bool executeMainThreadJob();
+        [[nodiscard]] static JobHandle pop(uint32_t index);
+        [[nodiscard]] static JobHandle steal(uint32_t thief);
+        static std::vector<std::thread>* workers;
+        static std::vector<std::unique_ptr<JobQueueSpecification>>* queues;
+        static JobQueueSpecification* mainThreadQueue;
+        static std::mutex sleepMutex;
+        static std::condition_variable sleepCondition;
+        static std::atomic<int> queuedJobs;
+        static std::atomic<uint32_t> nextQueue;
+        static std::atomic<bool> isRunning;
+        static std::atomic<std::thread::id> mainThreadId;
+        static thread_local int threadIndex;
+    };
+
+    template<typename Func>
+    void JobSystem::parallelFor(size_t count, size_t grainSize, const Func& func) {
+        if(count == 0)
+            return;
+        grainSize = std::max<size_t>(grainSize, 1);
+        size_t chunkCount = (count + grainSize - 1) / grainSize;
+        if(chunkCount == 1 || workers->empty()) {
+            func(size_t(0), count);
+            return;
+        }
+        std::vector<JobHandle> jobs;
+        jobs.reserve(chunkCount - 1);
+        for(size_t chunk = 1; chunk < chunkCount; ++chunk) {
+            size_t begin = chunk * grainSize;
+            size_t end = std::min(count, begin + grainSize);
+            jobs.push_back(submit([&func, begin, end]() { func(begin, end); }));
+        }
+        func(size_t(0), grainSize);
+        wait(jobs);
+    }
+
+    template<typename View, typename Func>
+    void JobSystem::parallelForEach(const View& view, size_t grainSize, const Func& func) {
+        std::vector<typename View::entity_type> entities(view.begin(), view.end());
+        parallelFor(entities.size(), grainSize, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+                func(entities[i]);
+        });
+    }
+}
+
+#endif
\ No newline at end of file
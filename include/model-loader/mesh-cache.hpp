@@ -0,0 +1,65 @@
+#ifndef MESH_CACHE_HPP
+#define MESH_CACHE_HPP
+
+#include <integer.hpp>
+#include <glad.h>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <cstring>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+
+#include "model-loader/model-loader-data.hpp"
+#include "model-loader/mesh-optimizer.hpp"
+#include "stream/mapped-file.hpp"
+#include "stream/cache-directory.hpp"
+
+namespace TWE {
+    struct MeshCacheHeaderSpecification {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t sourceHash = 0;
+        uint32_t meshCount = 0;
+        uint32_t lodCount = 0;
+    };
+
+    struct MeshCacheEntrySpecification {
+        uint32_t vertexCount = 0;
+        uint32_t indexCount = 0;
+        uint32_t indexType = 0;
+        uint32_t lodCount = 0;
+        float center[3] = { 0.f, 0.f, 0.f };
+        float radius = 0.f;
+        uint64_t vertexOffset = 0;
+        uint64_t indexOffset = 0;
+    };
+
+    struct MeshCacheLODEntrySpecification {
+        uint32_t indexCount = 0;
+        float error = 0.f;
+        uint64_t indexOffset = 0;
+    };
+
+    class MeshCache {
+    public:
+        [[nodiscard]] static std::filesystem::path getCachePath(const std::filesystem::path& sourcePath);
+        [[nodiscard]] static uint64_t calculateHash(const std::filesystem::path& sourcePath, const MeshOptimizationSpecification& optimizationSpec);
+        static bool read(const std::filesystem::path& cachePath, uint64_t sourceHash, MappedFile& cacheFile, std::vector<ModelMeshDataSpecification>& meshes);
+        static bool write(const std::filesystem::path& cachePath, uint64_t sourceHash, const std::vector<ModelMeshDataSpecification>& meshes);
+        static const std::string extension;
+        static const uint32_t magic;
+        static const uint32_t version;
+    private:
+        [[nodiscard]] static uint64_t hashBytes(const void* data, size_t size, uint64_t hash);
+        [[nodiscard]] static size_t getIndexSize(uint32_t indexType) noexcept;
+        [[nodiscard]] static bool isIndexRangeValid(const uint8_t* indices, uint32_t indexCount, uint32_t indexType, uint32_t vertexCount) noexcept;
+        [[nodiscard]] static uint64_t align(uint64_t offset, uint64_t alignment = 8) noexcept;
+        static std::atomic<uint32_t> writeCounter;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef MESH_OPTIMIZER_HPP
+#define MESH_OPTIMIZER_HPP
+
+#include <integer.hpp>
+#include <glm.hpp>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+namespace TWE {
+    struct MeshOptimizationSpecification {
+        MeshOptimizationSpecification() = default;
+        MeshOptimizationSpecification(bool weldVertices, bool optimizeVertexCache, bool optimizeOverdraw, bool optimizeVertexFetch, float overdrawThreshold = 1.05f)
+            : weldVertices(weldVertices), optimizeVertexCache(optimizeVertexCache), optimizeOverdraw(optimizeOverdraw),
+              optimizeVertexFetch(optimizeVertexFetch), overdrawThreshold(overdrawThreshold) {}
+        bool weldVertices = true;
+        bool optimizeVertexCache = true;
+        bool optimizeOverdraw = false;
+        bool optimizeVertexFetch = true;
+        float overdrawThreshold = 1.05f;
+        int cacheSize = 16;
+    };
+
+    struct MeshOptimizationStatistics {
+        int sourceVertexCount = 0;
+        int vertexCount = 0;
+        int triangleCount = 0;
+        float sourceACMR = 0.f;
+        float ACMR = 0.f;
+        float ATVR = 0.f;
+    };
+
+    class MeshOptimizer {
+    public:
+        static MeshOptimizationStatistics optimize(float* vertices, int& vertexCount, uint32_t* indices, int indexCount,
+            const MeshOptimizationSpecification& optimizationSpec = {});
+        static int weldVertices(float* vertices, int vertexCount, uint32_t* indices, int indexCount);
+        static void optimizeVertexCache(uint32_t* indices, int indexCount, int vertexCount, int cacheSize = 16);
+        static void optimizeOverdraw(uint32_t* indices, int indexCount, const float* vertices, int vertexCount, float threshold, int cacheSize = 16);
+        static int optimizeVertexFetch(float* vertices, int vertexCount, uint32_t* indices, int indexCount);
+        [[nodiscard]] static float calculateACMR(const uint32_t* indices, int indexCount, int vertexCount, int cacheSize = 16);
+        static const int vertexStride;
+    private:
+        [[nodiscard]] static uint32_t hashVertex(const float* vertex);
+        [[nodiscard]] static glm::vec3 getPosition(const float* vertices, uint32_t index);
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef MESH_SIMPLIFIER_HPP
+#define MESH_SIMPLIFIER_HPP
+
+#include <integer.hpp>
+#include <glm.hpp>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+namespace TWE {
+    struct Quadric {
+        Quadric() = default;
+        Quadric(const glm::vec3& normal, float distance, float weight);
+        Quadric& operator+=(const Quadric& quadric);
+        [[nodiscard]] float evaluate(const glm::vec3& point) const;
+        float a2 = 0.f, b2 = 0.f, c2 = 0.f;
+        float ab = 0.f, ac = 0.f, bc = 0.f;
+        float ad = 0.f, bd = 0.f, cd = 0.f;
+        float d2 = 0.f;
+        float weight = 0.f;
+    };
+
+    struct MeshCollapseSpecification {
+        MeshCollapseSpecification() = default;
+        MeshCollapseSpecification(uint32_t source, uint32_t target, float error)
+            : source(source), target(target), error(error) {}
+        uint32_t source = 0;
+        uint32_t target = 0;
+        float error = 0.f;
+    };
+
+    class MeshSimplifier {
+    public:
+        static std::vector<uint32_t> simplify(const float* vertices, int vertexCount, const uint32_t* indices, int indexCount,
+            int targetIndexCount, float targetError, float* resultError = nullptr);
+        [[nodiscard]] static float calculateRadius(const float* vertices, int vertexCount, glm::vec3* center = nullptr);
+        static const int vertexStride;
+    private:
+        static void classifyVertices(const float* vertices, int vertexCount, const std::vector<uint32_t>& indices, std::vector<bool>& locked);
+        static void calculateQuadrics(const float* vertices, const std::vector<uint32_t>& indices, std::vector<Quadric>& quadrics);
+        [[nodiscard]] static bool hasFlippedTriangles(const float* vertices, const std::vector<uint32_t>& indices,
+            const std::vector<uint32_t>& adjacencyOffsets, const std::vector<uint32_t>& adjacency, uint32_t source, uint32_t target);
+        [[nodiscard]] static glm::vec3 getPosition(const float* vertices, uint32_t index);
+    };
+}
+
+#endif
\ No newline at end of file
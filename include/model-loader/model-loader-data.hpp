@@ -2,14 +2,48 @@
 #define MODEL_LOADER_DATA_HPP
 
 #include <vector>
+#include <glm.hpp>
 
 #include "scene/components/mesh-component.hpp"
+#include "model-loader/mesh-optimizer.hpp"
 
 namespace TWE {
+    struct MeshBoundsSpecification {
+        MeshBoundsSpecification() = default;
+        MeshBoundsSpecification(const glm::vec3& center, float radius)
+            : center(center), radius(radius) {}
+        glm::vec3 center = glm::vec3(0.f);
+        float radius = 0.f;
+    };
+
+    struct MeshLODDataSpecification {
+        void* indices = nullptr;
+        int indexCount = 0;
+        uint32_t indexType = GL_UNSIGNED_INT;
+        float error = 0.f;
+        bool ownsIndices = true;
+    };
+
+    struct ModelMeshDataSpecification {
+        float* vertices = nullptr;
+        int vertexCount = 0;
+        void* indices = nullptr;
+        int indexCount = 0;
+        uint32_t indexType = GL_UNSIGNED_INT;
+        MeshBoundsSpecification bounds;
+        std::vector<MeshLODDataSpecification> lods;
+        bool ownsData = true;
+    };
+
     struct ModelLoaderData {
-        ModelLoaderData(const std::vector<MeshComponent>& meshComponents, const std::string& fullPath);
+        ModelLoaderData(const std::vector<MeshComponent>& meshComponents, const std::string& fullPath, 
+            const std::vector<MeshOptimizationStatistics>& meshStatistics = {}, const std::vector<MeshBoundsSpecification>& meshBounds = {}, 
+            const std::vector<std::vector<MeshLODDataSpecification>>& meshLODs = {});
         std::vector<MeshComponent> meshComponents;
         std::string fullPath;
+        std::vector<MeshOptimizationStatistics> meshStatistics;
+        std::vector<MeshBoundsSpecification> meshBounds;
+        std::vector<std::vector<MeshLODDataSpecification>> meshLODs;
     };
 }
 
@@ -7,22 +7,49 @@
 #include <string>
 #include <vector>
 #include <filesystem>
+#include <limits>
+#include <atomic>
+#include <future>
+#include <thread>
 
 #include "scene/components/components.hpp"
+#include "jobs/job-system.hpp"
 #include "model-loader-data.hpp"
+#include "mesh-optimizer.hpp"
+#include "mesh-simplifier.hpp"
+#include "mesh-cache.hpp"
 
 namespace TWE {
     class ModelLoader {
     public:
         ModelLoader() = default;
-        ModelLoaderData* loadModel(const std::string& path);
+        ~ModelLoader();
+        ModelLoaderData* loadModel(const std::string& path, const MeshOptimizationSpecification& optimizationSpec = {});
+        bool prepareModel(const std::string& path, const MeshOptimizationSpecification& optimizationSpec = {});
+        ModelLoaderData* uploadModel();
+        [[nodiscard]] const std::vector<ModelMeshDataSpecification>& getMeshData() const noexcept;
+        [[nodiscard]] const std::string& getErrorString() const noexcept;
     private:
         void clean();
+        bool importModel(const std::string& path, const MeshOptimizationSpecification& optimizationSpec);
         void procNode(aiNode* node, const aiScene* scene);
-        MeshComponent procMesh(aiMesh* mesh, const aiScene* scene);
+        void procMeshes();
+        ModelMeshDataSpecification procMesh(aiMesh* mesh, MeshOptimizationStatistics& statistics);
+        void procLODs(ModelMeshDataSpecification& mesh);
+        static void deleteIndices(void* indices, uint32_t indexType);
+        MeshComponent createArena(std::vector<SubmeshSpecification>& submeshes);
+        [[nodiscard]] bool isContiguous() const noexcept;
         std::vector<MeshComponent> meshes;
+        std::vector<ModelMeshDataSpecification> meshData;
+        std::vector<aiMesh*> sceneMeshes;
+        std::vector<MeshOptimizationStatistics> meshStatistics;
+        MeshOptimizationSpecification optimizationSpec;
         std::string filePath;
+        std::string errorString;
+        MappedFile cacheFile;
         bool hasTextures;
+        static const int maxLODCount;
+        static const float maxLODError;
     };
 }
 
@@ -12,6 +12,12 @@ namespace TWE {
         Orthographic
     };
 
+    enum class RenderPath {
+        Default,
+        Forward,
+        Deferred
+    };
+
     struct PerspectiveSpecification {
         bool operator==(const PerspectiveSpecification& spec) {
             return this->fov == spec.fov
@@ -52,6 +58,8 @@ namespace TWE {
 
     extern std::vector<std::string> cameraProjectionTypes;
 
+    extern std::vector<std::string> renderPaths;
+
     class Camera {
     public:
         Camera();
@@ -0,0 +1,41 @@
+#ifndef DEFERRED_RENDERER_HPP
+#define DEFERRED_RENDERER_HPP
+
+#include <glad.h>
+#include <glm.hpp>
+#include <gtc/matrix_transform.hpp>
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <filesystem>
+
+#include "renderer/renderer.hpp"
+#include "renderer/render-target-pool.hpp"
+#include "renderer/shader.hpp"
+
+namespace TWE {
+    class DeferredRenderer {
+    public:
+        static void init(const std::filesystem::path& rootPath);
+        static void render(std::vector<RenderLightSpecification>& lights, const SceneViewSpecification& sceneView, const std::vector<RenderItemSpecification>& renderItems, uint32_t viewMask, 
+            const glm::vec4& viewport, int lightsCount);
+        [[nodiscard]] static bool isDeferrable(const RendererSpecification& rendererSpec);
+        static const FBOAttachmentSpecification gBufferAttachments;
+        static const float lightCutoff;
+    private:
+        static void renderGeometry(const RendererSpecification& rendererSpec, const SceneCameraSpecification& camera);
+        static void renderLights(std::vector<RenderLightSpecification>& lights, const SceneCameraSpecification& camera, const glm::vec4& viewport, FBO& gBuffer);
+        static void setLight(RenderLightSpecification& light);
+        [[nodiscard]] static bool getLightScissor(const LightComponent& lightComponent, const glm::vec3& center, const glm::mat4& projectionView, 
+            const glm::vec4& viewport, glm::ivec4& scissor);
+        static std::vector<const RendererSpecification*> forwardItems;
+        static std::unique_ptr<Shader> gBufferShader;
+        static std::unique_ptr<Shader> lightShader;
+        static std::string defaultVertPath;
+        static std::string defaultFragPath;
+        static uint32_t vao;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef DYNAMIC_RESOLUTION_HPP
+#define DYNAMIC_RESOLUTION_HPP
+
+#include <glad.h>
+#include <glm.hpp>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include "renderer/fbo.hpp"
+
+namespace TWE {
+    class DynamicResolution {
+    public:
+        static void update();
+        static void beginGPUTimer();
+        static void endGPUTimer();
+        static void setIsEnabled(bool isEnabled);
+        static void setTargetFrameTime(float targetFrameTime);
+        [[nodiscard]] static FBOSizeSpecification getScaledSize(uint32_t width, uint32_t height);
+        [[nodiscard]] static bool getIsEnabled() noexcept;
+        [[nodiscard]] static float getTargetFrameTime() noexcept;
+        [[nodiscard]] static float getScale() noexcept;
+        static const float minScale;
+        static const float maxScale;
+        static const float scaleStep;
+        static const float frameTimeSmoothing;
+        static const float headroom;
+        static const int adjustDelay;
+        static const int queryCount;
+    private:
+        static void adjust(float gpuTime);
+        static std::vector<uint32_t> queries;
+        static int queryIndex;
+        static int pendingQueryCount;
+        static bool isTiming;
+        static bool isEnabled;
+        static float targetFrameTime;
+        static float averageGPUTime;
+        static float scale;
+        static int framesSinceAdjust;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -4,23 +4,37 @@
 #include <integer.hpp>
 #include <glad.h>
 
+#include "renderer/upload-manager.hpp"
+#include "jobs/job-system.hpp"
+
 namespace TWE {
     class EBO {
     public:
         EBO() = default;
         EBO(const EBO& ebo);
         EBO(uint32_t* indices, long int size, uint32_t drawType);
+        EBO(void* indices, long int size, uint32_t drawType, uint32_t indexType, bool ownsIndices = false);
         ~EBO();
         void bind();
         void unbind();
         void clean();
+        void releaseIndices();
         [[nodiscard]] uint32_t getId();
         [[nodiscard]] uint32_t* getIndices();
+        [[nodiscard]] void* getData();
         [[nodiscard]] long int getSize();
+        [[nodiscard]] uint32_t getIndexType();
+        [[nodiscard]] int getIndexSize();
+        [[nodiscard]] int getCount();
+        [[nodiscard]] long int getCPUSize();
+        [[nodiscard]] bool getIsUploaded();
     private:
         uint32_t _id;
-        uint32_t* _indices;
+        void* _indices;
         long int _size;
+        uint32_t _indexType;
+        bool _ownsIndices = false;
+        uint64_t _uploadTicket = 0;
     };
 }
 
@@ -4,12 +4,16 @@
 #include <glad.h>
 #include <memory>
 #include <vector>
+#include <algorithm>
+
+#include "jobs/job-system.hpp"
 
 namespace TWE {
     enum class FBOTextureFormat {
         None,
         R32I,
         RGBA8,
+        RGBA16F,
         DEPTH24STENCIL8
     };
 
@@ -42,18 +46,23 @@ namespace TWE {
         void unbind();
         void clean();
         void resize(uint32_t width, uint32_t height);
+        void blit(uint32_t targetId, uint32_t width, uint32_t height);
         [[nodiscard]] int readPixel(uint32_t colorAttachmentId, uint32_t x, uint32_t y);
         [[nodiscard]] FBOAttachmentSpecification& getAttachments();
         [[nodiscard]] uint32_t getId() const noexcept;
         [[nodiscard]] uint32_t getColorAttachment(uint32_t index) const noexcept;
         [[nodiscard]] uint32_t getDepthAttachment() const noexcept;
         [[nodiscard]] const FBOSizeSpecification& getSize() const noexcept;
+        [[nodiscard]] const FBOSizeSpecification& getCapacity() const noexcept;
+        static const uint32_t capacityStep;
+        static const float minCapacityUsage;
     private:
         void create();
         void attachColorTexture(uint32_t id, uint32_t index, uint32_t inFormat, uint32_t outFormat, uint32_t width, uint32_t height);
         void attachDepthTexture(uint32_t id, uint32_t inFormat, uint32_t outFormat, uint32_t width, uint32_t height);
         uint32_t _id;
         FBOSizeSpecification _size;
+        FBOSizeSpecification _capacity;
         FBOAttachmentSpecification _attachments;
         std::vector<FBOTextureSpecification> _colorSpecifications;
         FBOTextureSpecification _depthSpecification;
@@ -0,0 +1,58 @@
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "scene/scene-camera-specification.hpp"
+#include "scene/components/components.hpp"
+
+namespace TWE {
+    struct RendererSpecification {
+        RendererSpecification(MeshComponent& meshComponent, MeshRendererComponent& meshRendererComponent, TransformComponent& transformComponent)
+            : model(transformComponent.getModel()), vao(meshComponent.getVAO()), vbo(meshComponent.getVBO()), ebo(meshComponent.getEBO()),
+            texture(meshComponent.getTexture()), shader(meshRendererComponent.getShader()), lodChain(meshComponent.getLODChain()),
+            submesh(meshComponent.getModelMeshSpecification().submesh), material(meshRendererComponent.getMaterial()),
+            entityId(meshRendererComponent.getEntityId()), lodIndex(meshComponent.getLODIndex()), isModel(meshComponent.getModelMeshSpecification().isModel),
+            is3D(meshRendererComponent.getIs3D()), uniforms(meshRendererComponent.getUniforms()) {}
+        glm::mat4 model;
+        std::shared_ptr<VAO> vao;
+        std::shared_ptr<VBO> vbo;
+        std::shared_ptr<EBO> ebo;
+        std::shared_ptr<Texture> texture;
+        std::shared_ptr<Shader> shader;
+        std::shared_ptr<MeshLODChainSpecification> lodChain;
+        SubmeshSpecification submesh;
+        Material material;
+        int entityId;
+        int lodIndex;
+        bool isModel;
+        bool is3D;
+        std::shared_ptr<const std::vector<ShaderUniformSpecification>> uniforms;
+    };
+
+    struct RenderItemSpecification {
+        RenderItemSpecification(const RendererSpecification& rendererSpec, uint32_t viewMask)
+            : rendererSpec(rendererSpec), viewMask(viewMask) {}
+        RendererSpecification rendererSpec;
+        uint32_t viewMask;
+    };
+
+    struct RenderLightSpecification {
+        RenderLightSpecification(const LightComponent& lightComponent, TransformComponent& transformComponent)
+            : lightComponent(lightComponent), position(transformComponent.getPosition()), forward(transformComponent.getForward()) {}
+        LightComponent lightComponent;
+        glm::vec3 position;
+        glm::vec3 forward;
+    };
+
+    struct RenderSnapshotSpecification {
+        std::vector<SceneViewSpecification> views;
+        std::vector<RenderItemSpecification> draws;
+        std::vector<RenderLightSpecification> lights;
+        bool isFocusedOnDebugCamera = false;
+    };
+}
+
+#endif
\ No newline at end of file
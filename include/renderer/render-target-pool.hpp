@@ -0,0 +1,35 @@
+#ifndef RENDER_TARGET_POOL_HPP
+#define RENDER_TARGET_POOL_HPP
+
+#include <glad.h>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+#include "renderer/fbo.hpp"
+
+namespace TWE {
+    struct RenderTargetSpecification {
+        RenderTargetSpecification() = default;
+        RenderTargetSpecification(std::shared_ptr<FBO> fbo, const std::vector<FBOTextureFormat>& formats, uint64_t lastUsedFrame)
+            : fbo(fbo), formats(formats), lastUsedFrame(lastUsedFrame) {}
+        std::shared_ptr<FBO> fbo;
+        std::vector<FBOTextureFormat> formats;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    class RenderTargetPool {
+    public:
+        [[nodiscard]] static std::shared_ptr<FBO> acquire(uint32_t width, uint32_t height, const FBOAttachmentSpecification& attachments);
+        static void update();
+        static void clear();
+        [[nodiscard]] static size_t getCount();
+        static const uint64_t evictionDelay;
+    private:
+        [[nodiscard]] static std::vector<FBOTextureFormat> getFormats(const FBOAttachmentSpecification& attachments);
+        static std::vector<RenderTargetSpecification>* renderTargets;
+        static uint64_t frame;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef RENDER_THREAD_HPP
+#define RENDER_THREAD_HPP
+
+#include <glfw3.h>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+#include "renderer/render-snapshot.hpp"
+#include "renderer/renderer.hpp"
+#include "jobs/job-system.hpp"
+
+namespace TWE {
+    class RenderThread {
+    public:
+        RenderThread(GLFWwindow* window, const std::function<void(int)>& renderFrame);
+        ~RenderThread();
+        void submit();
+        [[nodiscard]] int getCaptureIndex() const noexcept;
+        [[nodiscard]] RenderSnapshotSpecification& getSnapshot(int index) noexcept;
+        static const std::chrono::milliseconds idleTimeout;
+    private:
+        void loop();
+        GLFWwindow* _window;
+        std::function<void(int)> _renderFrame;
+        RenderSnapshotSpecification _snapshots[2];
+        std::thread _thread;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        int _captureIndex;
+        int _renderIndex;
+        bool _isStarted;
+        bool _isRunning;
+    };
+}
+
+#endif
\ No newline at end of file
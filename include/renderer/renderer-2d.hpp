@@ -0,0 +1,62 @@
+#ifndef RENDERER_2D_HPP
+#define RENDERER_2D_HPP
+
+#include <glad.h>
+#include <glm.hpp>
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <filesystem>
+#include <cstddef>
+
+#include "renderer/renderer.hpp"
+#include "renderer/shader.hpp"
+
+namespace TWE {
+    struct Batch2DVertexSpecification {
+        glm::vec3 position;
+        glm::vec2 uv;
+        glm::vec4 color;
+        float textureSlot;
+        int32_t entityId;
+    };
+
+    struct Batch2DItemSpecification {
+        Batch2DItemSpecification(const RendererSpecification* rendererSpec, float layer, uint32_t texture, bool isBatched)
+            : rendererSpec(rendererSpec), layer(layer), texture(texture), isBatched(isBatched) {}
+        const RendererSpecification* rendererSpec;
+        float layer;
+        uint32_t texture;
+        bool isBatched;
+    };
+
+    class Renderer2D {
+    public:
+        static void init(const std::filesystem::path& rootPath);
+        static void submit(const RendererSpecification& rendererSpec);
+        static void render();
+        [[nodiscard]] static int getDrawCount() noexcept;
+        static const int maxVertices;
+        static const int maxIndices;
+        static const int maxMeshVertices;
+        static const int maxTextureSlots;
+    private:
+        static bool append(const RendererSpecification& rendererSpec, uint32_t texture);
+        static void flush();
+        [[nodiscard]] static bool isBatchable(const RendererSpecification& rendererSpec);
+        static std::vector<Batch2DItemSpecification> items;
+        static std::vector<Batch2DVertexSpecification> vertices;
+        static std::vector<uint32_t> indices;
+        static std::vector<uint32_t> textureSlots;
+        static std::unique_ptr<Shader> shader;
+        static std::string uiVertPath;
+        static std::string uiFragPath;
+        static uint32_t vao;
+        static uint32_t vbo;
+        static uint32_t ebo;
+        static int drawCount;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -4,12 +4,15 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <algorithm>
+#include <cfloat>
 #include <entt/entt.hpp>
 
 #include "scene/iscene.hpp"
 #include "scene/components/components.hpp"
 
 #include "renderer/texture.hpp"
+#include "renderer/render-snapshot.hpp"
 
 namespace TWE {
     struct LightShaderNamesSpecification {
@@ -29,12 +32,8 @@ namespace TWE {
         std::string lightSpaceMat;
     };
 
-    struct RendererSpecification {
-        RendererSpecification(MeshComponent* meshComponent, MeshRendererComponent* meshRendererComponent, TransformComponent* transformComponent)
-            : meshComponent(meshComponent), meshRendererComponent(meshRendererComponent), transformComponent(transformComponent) {}
-        MeshComponent* meshComponent;
-        MeshRendererComponent* meshRendererComponent;
-        TransformComponent* transformComponent;
+    struct FrustumSpecification {
+        glm::vec4 planes[6];
     };
 
     class Renderer {
@@ -44,16 +43,46 @@ namespace TWE {
         static void render3D(const RendererSpecification& rendererSpec, const glm::vec3& cameraPosition, const glm::mat4& cameraView, const glm::mat4& cameraProjection, 
             const glm::mat4& cameraProjectionView, int lightsCount);
         static void renderScene(IScene* scene);
+        static void captureScene(IScene* scene, RenderSnapshotSpecification& snapshot);
+        static void renderSnapshot(RenderSnapshotSpecification& snapshot);
+        static void clearSnapshot(RenderSnapshotSpecification& snapshot);
         static void cleanScreen(const glm::vec4& color);
         static void cleanDepth();
         static void setViewport(int startX, int startY, int endX, int endY);
-        static void setLight(MeshRendererComponent& meshRendererComponent, const LightComponent& light, TransformComponent& transform, int lightIndex);
-        static void setShadows(MeshRendererComponent& meshRendererComponent, const glm::mat4& lightSpaceMat, int lightIndex);
-        static void generateDepthMap(LightComponent& lightComponent, const TransformComponent& transformComponent, const glm::mat4& lightProjection, 
-                                     const glm::mat4& lightView, const glm::mat4& projectionView, IScene* scene);
+        static void setLight(Shader& shader, const RenderLightSpecification& light, int lightIndex);
+        static void setShadows(Shader& shader, const glm::mat4& lightSpaceMat, int lightIndex);
+        static void setMatsUniform(Shader& shader, const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection, const glm::mat4& projectionView);
+        static void setMaterialUniform(Shader& shader, const Material& material);
+        static void setCustomUniforms(Shader& shader, const RendererSpecification& rendererSpec);
+        static void generateDepthMap(LightComponent& lightComponent, const glm::vec3& position, const glm::mat4& lightProjection, 
+                                     const glm::mat4& lightView, const glm::mat4& projectionView, const std::vector<RenderItemSpecification>& draws);
+        static void setVertexLayout(Shader& shader, VBO& vbo);
+        static void drawMesh(const RendererSpecification& rendererSpec, int lodIndex);
+        [[nodiscard]] static int selectLOD(const MeshLODChainSpecification* lodChain, int lodIndex, const glm::mat4& model, const glm::vec3& cameraPosition, 
+            const glm::mat4& cameraProjection);
+        static void requestTextureLevels(const RendererSpecification& rendererSpec, const glm::vec3& cameraPosition, const glm::mat4& cameraProjection);
+        static void setLODBias(float lodBias);
+        [[nodiscard]] static float getLODBias() noexcept;
+        [[nodiscard]] static FrustumSpecification createFrustum(const glm::mat4& projectionView);
+        [[nodiscard]] static bool isVisible(const FrustumSpecification& frustum, const glm::vec3& center, float radius);
+        [[nodiscard]] static bool getBoundingSphere(const MeshLODChainSpecification* lodChain, const glm::mat4& model, glm::vec3& center, float& radius);
+        static const int maxViews;
     private:
-        static void renderShadowMap(IScene* scene, const glm::vec3& position, const glm::mat4& view, const glm::mat4& projection, const glm::mat4& projectionView);
+        static void collectScene(IScene* scene, const std::vector<SceneViewSpecification>& views, bool isFocusedOnDebugCamera, 
+            std::vector<RenderItemSpecification>& draws, std::vector<RenderLightSpecification>& lights);
+        static void renderViews(const std::vector<SceneViewSpecification>& views, const std::vector<RenderItemSpecification>& draws, 
+            std::vector<RenderLightSpecification>& lights, bool isFocusedOnDebugCamera);
+        static void renderView(const SceneViewSpecification& sceneView, const std::vector<RenderItemSpecification>& draws, int viewIndex, int lightsCount);
+        static void renderLights(const std::vector<RenderItemSpecification>& draws, std::vector<RenderLightSpecification>& lights);
+        static void renderShadowMap(const std::vector<RenderItemSpecification>& draws, const glm::vec3& position, const glm::mat4& view, const glm::mat4& projection, 
+            const glm::mat4& projectionView);
+        static void resolveLODChain(MeshComponent& meshComponent);
         static std::vector<LightShaderNamesSpecification> lightShaderNames;
+        static float lodBias;
+        static int viewportWidth;
+        static int viewportHeight;
+        static const float lodErrorThreshold;
+        static const float lodHysteresis;
     };
 }
 
@@ -0,0 +1,73 @@
+#ifndef SHADER_CACHE_HPP
+#define SHADER_CACHE_HPP
+
+#include <glad.h>
+#include <map>
+#include <set>
+#include <memory>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <cstring>
+#include <cstdint>
+
+#include "stream/file.hpp"
+#include "stream/file-watcher.hpp"
+#include "stream/cache-directory.hpp"
+
+namespace TWE {
+    struct ShaderCacheHeaderSpecification {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t key = 0;
+        uint32_t format = 0;
+        uint32_t size = 0;
+    };
+
+    struct ShaderBinarySpecification {
+        ShaderBinarySpecification() = default;
+        ShaderBinarySpecification(const std::string& vertPath, const std::string& fragPath, uint32_t format, std::vector<uint8_t>&& data)
+            : vertPath(vertPath), fragPath(fragPath), format(format), data(std::move(data)) {}
+        std::string vertPath;
+        std::string fragPath;
+        uint32_t format = 0;
+        std::vector<uint8_t> data;
+    };
+
+    class ShaderCache {
+    public:
+        [[nodiscard]] static uint32_t createProgram(const std::string& vertPath, const std::string& fragPath, const std::vector<std::string>& defines = {});
+        #ifndef TWE_BUILD
+        static void update();
+        #endif
+        static void clear();
+        [[nodiscard]] static std::filesystem::path getCachePath(const std::string& vertPath, const std::string& fragPath, const std::vector<std::string>& defines);
+        [[nodiscard]] static uint64_t calculateKey(const std::string& vertBody, const std::string& fragBody, const std::vector<std::string>& defines);
+        [[nodiscard]] static bool isBinarySupported();
+        static const std::string extension;
+        static const uint32_t magic;
+        static const uint32_t version;
+    private:
+        [[nodiscard]] static uint32_t compileProgram(const std::string& vertBody, const std::string& fragBody);
+        [[nodiscard]] static uint32_t compileShader(const char* body, uint32_t shaderType);
+        [[nodiscard]] static uint32_t loadBinary(const ShaderBinarySpecification& binary);
+        [[nodiscard]] static bool readBinary(const std::filesystem::path& cachePath, uint64_t key, ShaderBinarySpecification& binary);
+        static void writeBinary(const std::filesystem::path& cachePath, uint64_t key, const ShaderBinarySpecification& binary);
+        #ifndef TWE_BUILD
+        static void watch(const std::string& path);
+        #endif
+        [[nodiscard]] static std::string applyDefines(const std::string& body, const std::vector<std::string>& defines);
+        [[nodiscard]] static std::filesystem::path getAbsolutePath(const std::string& path);
+        [[nodiscard]] static std::string getBinaryId(const std::string& vertPath, const std::string& fragPath, const std::vector<std::string>& defines);
+        [[nodiscard]] static uint64_t hashBytes(const void* data, size_t size, uint64_t hash);
+        static std::map<std::string, ShaderBinarySpecification>* binaries;
+        #ifndef TWE_BUILD
+        static std::map<std::filesystem::path, std::string>* watchedFiles;
+        static std::map<std::filesystem::path, std::unique_ptr<FileWatcher>>* watchers;
+        #endif
+    };
+}
+
+#endif
\ No newline at end of file
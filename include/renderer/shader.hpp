@@ -4,8 +4,14 @@
 #include <glad.h>
 #include <gtc/type_ptr.hpp>
 #include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <mutex>
+#include <variant>
 
-#include "stream/file.hpp"
+#include "renderer/shader-cache.hpp"
+#include "jobs/job-system.hpp"
 
 namespace TWE {
     enum TransformMatrixOptions {
@@ -25,36 +31,62 @@ namespace TWE {
         COLLIDER_FRAG,
         UI_VERT,
         UI_FRAG,
+        BATCH_2D_VERT,
+        BATCH_2D_FRAG,
+        GBUFFER_FRAG,
+        DEFERRED_VERT,
+        DEFERRED_FRAG,
     };
 
     extern const char* TRANS_MAT_OPTIONS[5];
 
-    extern const char* SHADER_PATHS[8];
+    extern const char* SHADER_PATHS[13];
+
+    using ShaderUniformValue = std::variant<glm::mat4, glm::vec3, glm::vec2, float, uint32_t, int, bool>;
+
+    struct ShaderUniformSpecification {
+        ShaderUniformSpecification(const std::string& name, const ShaderUniformValue& value)
+            : name(name), value(value) {}
+        std::string name;
+        ShaderUniformValue value;
+    };
 
     class Shader {
     public:
         Shader() = default;
         Shader(const Shader& shader);
-        Shader(const char* vertPath, const char* fragPath);
+        Shader(const char* vertPath, const char* fragPath, const std::vector<std::string>& defines = {});
         ~Shader();
         void use();
         void clean();
+        #ifndef TWE_BUILD
+        static void reload(const std::string& path);
+        #endif
         void setUniform(const char* name, const glm::mat4& mat);
         void setUniform(const char* name, const glm::vec3& vec);
+        void setUniform(const char* name, const glm::vec2& vec);
         void setUniform(const char* name, float value);
         void setUniform(const char* name, uint32_t value);
         void setUniform(const char* name, int value);
         void setUniform(const char* name, bool value);
+        void setUniform(const ShaderUniformSpecification& uniform);
         [[nodiscard]] uint32_t getId() const noexcept;
         [[nodiscard]] std::string getVertPath() const noexcept;
         [[nodiscard]] std::string getFragPath() const noexcept;
     private:
-        [[nodiscard]] uint32_t create(const char* fileContent, uint32_t shaderType);
-        void linkShaders(uint32_t* shaders, uint32_t size);
+        #ifndef TWE_BUILD
+        static void copyUniforms(uint32_t source, uint32_t destination);
+        static void copyUniform(uint32_t source, uint32_t type, int sourceLocation, int destinationLocation);
+        #endif
         uint32_t _id;
         std::string _vertPath;
         std::string _fragPath;
+        std::vector<std::string> _defines;
         static uint32_t currentShaderInUseID;
+        #ifndef TWE_BUILD
+        static std::set<Shader*>* shaders;
+        static std::mutex* shadersMutex;
+        #endif
     };
 }
 
@@ -0,0 +1,17 @@
+#ifndef SUBMESH_SPECIFICATION_HPP
+#define SUBMESH_SPECIFICATION_HPP
+
+namespace TWE {
+    struct SubmeshSpecification {
+        SubmeshSpecification() = default;
+        SubmeshSpecification(int indexOffset, int indexCount, int baseVertex, int vertexCount)
+            : indexOffset(indexOffset), indexCount(indexCount), baseVertex(baseVertex), vertexCount(vertexCount) {}
+        [[nodiscard]] bool isValid() const noexcept { return indexCount > 0; }
+        int indexOffset = 0;
+        int indexCount = 0;
+        int baseVertex = 0;
+        int vertexCount = 0;
+    };
+}
+
+#endif
\ No newline at end of file
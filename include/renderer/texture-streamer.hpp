@@ -0,0 +1,73 @@
+#ifndef TEXTURE_STREAMER_HPP
+#define TEXTURE_STREAMER_HPP
+
+#include <glad.h>
+#include <stb_image.h>
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+#include "renderer/upload-manager.hpp"
+#include "jobs/job-system.hpp"
+
+namespace TWE {
+    struct TextureMipLevelSpecification {
+        TextureMipLevelSpecification() = default;
+        TextureMipLevelSpecification(int level, int width, int height, std::vector<uint8_t>&& pixels)
+            : level(level), width(width), height(height), pixels(std::move(pixels)) {}
+        int level = 0;
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    struct TextureStreamingSpecification {
+        TextureStreamingSpecification() = default;
+        std::string imgPath;
+        uint32_t textureType = GL_TEXTURE_2D;
+        uint32_t format = GL_RGBA;
+        int width = 0;
+        int height = 0;
+        int levelCount = 1;
+        int initialLevel = 0;
+        int residentLevel = 0;
+        int neededLevel = 0;
+        int requestedLevel = 0;
+        uint64_t lastRequestFrame = 0;
+        bool isLoading = false;
+        JobHandle loadingJob;
+        std::shared_ptr<std::vector<TextureMipLevelSpecification>> loadedLevels;
+    };
+
+    class TextureStreamer {
+    public:
+        static void registerTexture(uint32_t id, const std::string& imgPath, uint32_t textureType, uint32_t format, const uint8_t* pixels, int width, int height);
+        static void unregisterTexture(uint32_t id);
+        static void requestLevel(uint32_t id, float pixelsPerUV = FLT_MAX);
+        static void update();
+        static void setBudget(size_t budget);
+        [[nodiscard]] static std::vector<TextureMipLevelSpecification> generateMipLevels(const uint8_t* pixels, int width, int height, int firstLevel, int lastLevel);
+        [[nodiscard]] static size_t getResidentSize();
+        [[nodiscard]] static size_t getBudget() noexcept;
+        static const size_t defaultBudget;
+        static const int residentSize;
+        static const int maxLoadsPerFrame;
+        static const uint64_t dropDelay;
+    private:
+        static void loadLevels(uint32_t id, TextureStreamingSpecification& texture, int level);
+        static void uploadLevels(uint32_t id, TextureStreamingSpecification& texture, std::vector<TextureMipLevelSpecification>&& levels);
+        static void dropLevels(uint32_t id, TextureStreamingSpecification& texture, int level);
+        static void downsample(const uint8_t* source, int width, int height, std::vector<uint8_t>& result);
+        [[nodiscard]] static size_t getLevelsSize(const TextureStreamingSpecification& texture, int firstLevel);
+        [[nodiscard]] static int getLevelSize(int size, int level);
+        static std::map<uint32_t, TextureStreamingSpecification>* textures;
+        static size_t budget;
+        static uint64_t frame;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -8,6 +8,9 @@
 
 #include "shader.hpp"
 #include "fbo.hpp"
+#include "upload-manager.hpp"
+#include "texture-streamer.hpp"
+#include "jobs/job-system.hpp"
 
 namespace TWE {
     enum class TextureType {
@@ -80,6 +83,7 @@ namespace TWE {
         void setAttachments(const TextureAttachmentSpecification& attachments);
         void setTexture(const TextureSpecification& textureSpec);
         void removeTexture(uint32_t texNumber);
+        void requestLevel(float pixelsPerUV = FLT_MAX);
         [[nodiscard]] uint32_t getId(int index) const noexcept;
         [[nodiscard]] uint32_t getIndexByTexNumber(uint32_t texNumber) const noexcept;
         [[nodiscard]] TextureSpecification* getTextureSpecByTexNumber(uint32_t texNumber);
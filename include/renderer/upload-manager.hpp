@@ -0,0 +1,91 @@
+#ifndef UPLOAD_MANAGER_HPP
+#define UPLOAD_MANAGER_HPP
+
+#include <glad.h>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+
+namespace TWE {
+    enum class UploadTargetType {
+        Buffer,
+        Texture
+    };
+
+    struct UploadRequestSpecification {
+        UploadRequestSpecification() = default;
+        UploadRequestSpecification(UploadTargetType targetType, uint32_t destination, std::vector<uint8_t>&& data)
+            : targetType(targetType), destination(destination), data(std::move(data)) {}
+        uint64_t ticket = 0;
+        UploadTargetType targetType = UploadTargetType::Buffer;
+        uint32_t destination = 0;
+        std::vector<uint8_t> data;
+        size_t uploadedSize = 0;
+        size_t destinationOffset = 0;
+        uint32_t textureType = GL_TEXTURE_2D;
+        int level = 0;
+        int width = 0;
+        int height = 0;
+        uint32_t format = GL_RGBA;
+        uint32_t type = GL_UNSIGNED_BYTE;
+        std::function<void()> onUploaded;
+    };
+
+    struct UploadChunkSpecification {
+        UploadChunkSpecification() = default;
+        UploadChunkSpecification(UploadRequestSpecification* request, size_t stagingOffset, size_t dataOffset, size_t size)
+            : request(request), stagingOffset(stagingOffset), dataOffset(dataOffset), size(size) {}
+        UploadRequestSpecification* request = nullptr;
+        size_t stagingOffset = 0;
+        size_t dataOffset = 0;
+        size_t size = 0;
+    };
+
+    struct UploadFenceSpecification {
+        UploadFenceSpecification() = default;
+        UploadFenceSpecification(GLsync fence, uint64_t ticket)
+            : fence(fence), ticket(ticket) {}
+        GLsync fence = nullptr;
+        uint64_t ticket = 0;
+    };
+
+    class UploadManager {
+    public:
+        static void init(size_t frameBudget = defaultFrameBudget);
+        static void update();
+        static uint64_t uploadBuffer(uint32_t buffer, const void* data, size_t size, size_t destinationOffset = 0);
+        static uint64_t uploadBuffer(uint32_t buffer, std::vector<uint8_t>&& data, size_t destinationOffset = 0);
+        static uint64_t uploadTexture(uint32_t texture, uint32_t textureType, int level, int width, int height, uint32_t format, uint32_t type,
+            std::vector<uint8_t>&& data, const std::function<void()>& onUploaded = {});
+        static void cancel(uint64_t ticket);
+        static void cancel(UploadTargetType targetType, uint32_t destination);
+        static void setFrameBudget(size_t frameBudget);
+        [[nodiscard]] static bool isUploaded(uint64_t ticket) noexcept;
+        [[nodiscard]] static bool isComplete(uint64_t ticket) noexcept;
+        [[nodiscard]] static size_t getFrameBudget() noexcept;
+        [[nodiscard]] static size_t getPendingSize() noexcept;
+        static const size_t defaultFrameBudget;
+        static const int stagingBufferCount;
+    private:
+        static uint64_t submit(UploadRequestSpecification&& request);
+        static void uploadDirect(UploadRequestSpecification& request);
+        static void uploadChunk(const UploadChunkSpecification& chunk, uint32_t stagingBuffer);
+        static void pollFences();
+        static void cancel(const std::function<bool(const UploadRequestSpecification&)>& isCancelled);
+        [[nodiscard]] static size_t getRowSize(const UploadRequestSpecification& request);
+        static std::deque<UploadRequestSpecification> requests;
+        static std::deque<UploadFenceSpecification> fences;
+        static std::vector<uint32_t> stagingBuffers;
+        static int stagingIndex;
+        static size_t frameBudget;
+        static size_t pendingSize;
+        static uint64_t nextTicket;
+        static uint64_t completedTicket;
+        static bool isInitialized;
+    };
+}
+
+#endif
\ No newline at end of file
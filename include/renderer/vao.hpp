@@ -5,6 +5,7 @@
 #include <glad.h>
 
 #include "vbo.hpp"
+#include "jobs/job-system.hpp"
 
 namespace TWE {
     class VAO {
@@ -16,6 +17,7 @@ namespace TWE {
         void unbind();
         void clean();
         void setAttrib(uint32_t layout, int size, uint32_t type, bool normalized, int step, const void* offset, VBO& vbo);
+        void setLayout(const VertexLayout& layout, VBO& vbo);
         [[nodiscard]] uint32_t getId();
     private:
         uint32_t _id;
@@ -4,23 +4,39 @@
 #include <integer.hpp>
 #include <glad.h>
 
+#include "renderer/vertex-layout.hpp"
+#include "renderer/upload-manager.hpp"
+#include "jobs/job-system.hpp"
+
 namespace TWE {
     class VBO {
     public:
         VBO() = default;
         VBO(const VBO& vbo);
-        VBO(float* vertices, long int size, uint32_t drawType);
+        VBO(float* vertices, long int size, uint32_t drawType, const VertexLayout& layout = VertexLayout::createDefault(), bool ownsVertices = false);
         ~VBO();
         void bind();
         void unbind();
         void clean();
+        void releaseVertices();
         [[nodiscard]] uint32_t getId();
         [[nodiscard]] float* getVertices();
+        [[nodiscard]] const float* getPositions();
         [[nodiscard]] long int getSize();
+        [[nodiscard]] long int getBufferSize();
+        [[nodiscard]] int getVertexCount();
+        [[nodiscard]] long int getCPUSize();
+        [[nodiscard]] const VertexLayout& getLayout();
+        [[nodiscard]] bool getIsUploaded();
     private:
         uint32_t _id;
         float* _vertices;
+        std::vector<float> _positions;
+        bool _ownsVertices = false;
         long int _size;
+        long int _bufferSize;
+        VertexLayout _layout;
+        uint64_t _uploadTicket = 0;
     };
 }
 
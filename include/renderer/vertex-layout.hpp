@@ -0,0 +1,71 @@
+#ifndef VERTEX_LAYOUT_HPP
+#define VERTEX_LAYOUT_HPP
+
+#include <glad.h>
+#include <glm.hpp>
+#include <gtc/packing.hpp>
+#include <vector>
+#include <cstring>
+#include <initializer_list>
+
+namespace TWE {
+    enum class VertexAttributeFormat {
+        Float2,
+        Float3,
+        Half2,
+        Snorm16x4,
+        Snorm10x3
+    };
+
+    enum VertexAttributeLocation {
+        POSITION,
+        NORMAL,
+        UV
+    };
+
+    struct VertexAttributeSpecification {
+        VertexAttributeSpecification() = default;
+        VertexAttributeSpecification(VertexAttributeLocation location, VertexAttributeFormat format)
+            : location(location), format(format) {}
+        bool operator==(const VertexAttributeSpecification& attribute) const {
+            return this->location == attribute.location
+                && this->format == attribute.format
+                && this->offset == attribute.offset;
+        }
+        VertexAttributeLocation location = VertexAttributeLocation::POSITION;
+        VertexAttributeFormat format = VertexAttributeFormat::Float3;
+        uint32_t offset = 0;
+    };
+
+    struct VertexDequantizationSpecification {
+        glm::vec3 positionScale = glm::vec3(1.f);
+        glm::vec3 positionOffset = glm::vec3(0.f);
+    };
+
+    class VertexLayout {
+    public:
+        VertexLayout();
+        VertexLayout(std::initializer_list<VertexAttributeSpecification> attributes);
+        void pack(const float* vertices, int vertexCount, std::vector<uint8_t>& packed);
+        [[nodiscard]] bool isDefault() const noexcept;
+        [[nodiscard]] uint32_t getStride() const noexcept;
+        [[nodiscard]] const std::vector<VertexAttributeSpecification>& getAttributes() const noexcept;
+        [[nodiscard]] const VertexDequantizationSpecification& getDequantization() const noexcept;
+        [[nodiscard]] static uint32_t getFormatSize(VertexAttributeFormat format) noexcept;
+        [[nodiscard]] static int getFormatComponents(VertexAttributeFormat format) noexcept;
+        [[nodiscard]] static uint32_t getFormatType(VertexAttributeFormat format) noexcept;
+        [[nodiscard]] static bool getFormatNormalized(VertexAttributeFormat format) noexcept;
+        static VertexLayout createDefault();
+        static VertexLayout createCompact(bool quantizePositions = false);
+        static const int sourceStride;
+    private:
+        void calculateOffsets();
+        void calculateDequantization(const float* vertices, int vertexCount);
+        void packAttribute(const VertexAttributeSpecification& attribute, const float* vertex, uint8_t* dest);
+        std::vector<VertexAttributeSpecification> _attributes;
+        VertexDequantizationSpecification _dequantization;
+        uint32_t _stride;
+    };
+}
+
+#endif
\ No newline at end of file
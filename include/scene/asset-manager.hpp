@@ -0,0 +1,56 @@
+#ifndef ASSET_MANAGER_HPP
+#define ASSET_MANAGER_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <memory>
+#include <filesystem>
+#include <algorithm>
+
+#include "scene/shape-specification.hpp"
+#include "scene/asset-reference-specification.hpp"
+
+namespace TWE {
+    struct AssetResidencySpecification {
+        AssetResidencySpecification() = default;
+        std::filesystem::path modelPath;
+        std::vector<std::string> meshIds;
+        std::weak_ptr<AssetReferenceSpecification> reference;
+        size_t cpuSize = 0;
+        size_t gpuSize = 0;
+        uint64_t lastUsedFrame = 0;
+        bool isResident = false;
+    };
+
+    class AssetManager {
+    public:
+        static void update();
+        static void reset();
+        static void trackModel(const std::filesystem::path& modelPath, const std::vector<MeshSpecification*>& meshSpecifications);
+        static void touch(const std::filesystem::path& modelPath);
+        static std::shared_ptr<AssetReferenceSpecification> acquire(const std::filesystem::path& modelPath);
+        static bool evict(const std::filesystem::path& modelPath);
+        static void setBudgets(size_t cpuBudget, size_t gpuBudget);
+        [[nodiscard]] static bool isResident(const std::filesystem::path& modelPath);
+        [[nodiscard]] static size_t getCPUSize() noexcept;
+        [[nodiscard]] static size_t getGPUSize() noexcept;
+        [[nodiscard]] static size_t getCPUBudget() noexcept;
+        [[nodiscard]] static size_t getGPUBudget() noexcept;
+        static const size_t defaultCPUBudget;
+        static const size_t defaultGPUBudget;
+        static const uint64_t evictionDelay;
+    private:
+        static void evict(AssetResidencySpecification& asset);
+        [[nodiscard]] static bool isReferenced(const AssetResidencySpecification& asset);
+        [[nodiscard]] static std::string getAssetKey(const std::filesystem::path& modelPath);
+        static std::map<std::string, AssetResidencySpecification> assets;
+        static size_t cpuSize;
+        static size_t gpuSize;
+        static size_t cpuBudget;
+        static size_t gpuBudget;
+        static uint64_t frame;
+    };
+}
+
+#endif
\ No newline at end of file
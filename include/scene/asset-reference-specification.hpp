@@ -0,0 +1,15 @@
+#ifndef ASSET_REFERENCE_SPECIFICATION_HPP
+#define ASSET_REFERENCE_SPECIFICATION_HPP
+
+#include <filesystem>
+
+namespace TWE {
+    struct AssetReferenceSpecification {
+        AssetReferenceSpecification() = default;
+        AssetReferenceSpecification(const std::filesystem::path& modelPath)
+            : modelPath(modelPath) {}
+        std::filesystem::path modelPath;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -2,10 +2,39 @@
 #define CAMERA_COMPONENT_HPP
 
 #include <memory>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <glm.hpp>
 
 #include "renderer/camera.hpp"
+#include "renderer/fbo.hpp"
 
 namespace TWE {
+    enum class CameraUpdateMode {
+        EveryFrame,
+        EveryNFrames,
+        OnDemand
+    };
+
+    extern std::vector<std::string> cameraUpdateModes;
+
+    struct CameraRenderTargetSpecification {
+        bool operator==(const CameraRenderTargetSpecification& spec) const {
+            return this->width == spec.width
+                && this->height == spec.height
+                && this->updateMode == spec.updateMode
+                && this->updateInterval == spec.updateInterval;
+        }
+        bool operator!=(const CameraRenderTargetSpecification& spec) const {
+            return !(*this == spec);
+        }
+        uint32_t width = 0;
+        uint32_t height = 0;
+        CameraUpdateMode updateMode = CameraUpdateMode::EveryFrame;
+        int updateInterval = 1;
+    };
+
     class CameraComponent {
     public:
         CameraComponent();
@@ -13,11 +42,29 @@ namespace TWE {
         ~CameraComponent();
         void setSource(const Camera& source);
         void setFocuse(bool isFocusedOn);
+        void setRenderTargetSpecification(const CameraRenderTargetSpecification& renderTargetSpecification);
+        void setViewport(const glm::vec4& viewport);
+        void setRenderPath(RenderPath renderPath);
+        void requestRender();
+        [[nodiscard]] bool shouldRender();
         [[nodiscard]] bool isFocusedOn() const noexcept;
+        [[nodiscard]] bool hasRenderTarget() const noexcept;
         [[nodiscard]] Camera* getSource();
+        [[nodiscard]] std::shared_ptr<FBO> getRenderTarget();
+        [[nodiscard]] uint32_t getRenderTexture();
+        [[nodiscard]] const CameraRenderTargetSpecification& getRenderTargetSpecification() const noexcept;
+        [[nodiscard]] const glm::vec4& getViewport() const noexcept;
+        [[nodiscard]] RenderPath getRenderPath() const noexcept;
     private:
         Camera _camera;
+        CameraRenderTargetSpecification _renderTargetSpecification;
+        std::shared_ptr<FBO> _renderTarget;
+        glm::vec4 _viewport;
+        RenderPath _renderPath;
+        int _framesSinceRender;
+        bool _needRender;
         bool _isFocusedOn;
+        static const FBOAttachmentSpecification renderTargetAttachments;
     };
 }
 
@@ -2,6 +2,7 @@
 #define MESH_COMPONENT_HPP
 
 #include <glad.h>
+#include <glm.hpp>
 #include <memory>
 #include <vector>
 #include <string>
@@ -10,15 +11,33 @@
 #include "renderer/vbo.hpp"
 #include "renderer/ebo.hpp"
 #include "renderer/texture.hpp"
+#include "renderer/submesh-specification.hpp"
+#include "scene/asset-reference-specification.hpp"
 
 namespace TWE {
     struct ModelMeshSpecification {
         ModelMeshSpecification() = default;
-        ModelMeshSpecification(bool isModel, const std::filesystem::path& modelPath, int modelIndex)
-            : isModel(isModel), modelPath(modelPath), modelIndex(modelIndex) {}
+        ModelMeshSpecification(bool isModel, const std::filesystem::path& modelPath, int modelIndex, const SubmeshSpecification& submesh = {})
+            : isModel(isModel), modelPath(modelPath), modelIndex(modelIndex), submesh(submesh) {}
         bool isModel = false;
         std::filesystem::path modelPath = "";
         int modelIndex = -1;
+        SubmeshSpecification submesh;
+    };
+
+    struct MeshLODSpecification {
+        MeshLODSpecification() = default;
+        MeshLODSpecification(std::shared_ptr<VAO> vao, std::shared_ptr<EBO> ebo, float error)
+            : vao(vao), ebo(ebo), error(error) {}
+        std::shared_ptr<VAO> vao;
+        std::shared_ptr<EBO> ebo;
+        float error = 0.f;
+    };
+
+    struct MeshLODChainSpecification {
+        std::vector<MeshLODSpecification> lods;
+        glm::vec3 center = glm::vec3(0.f);
+        float radius = 0.f;
     };
 
     class MeshComponent {
@@ -28,6 +47,9 @@ namespace TWE {
             const ModelMeshSpecification& modelSpec = {}, const TextureAttachmentSpecification& textureAtttachments = {});
         MeshComponent(float* vertices, int vertSize, uint32_t* indices, int indSize, const std::string& registryId, 
             const ModelMeshSpecification& modelSpec, Texture* texture);
+        MeshComponent(float* vertices, int vertSize, void* indices, int indSize, uint32_t indexType, const VertexLayout& layout, 
+            const std::string& registryId, const ModelMeshSpecification& modelSpec = {}, const TextureAttachmentSpecification& textureAtttachments = {}, 
+            bool ownsData = false);
         MeshComponent(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const std::string& registryId, 
             const ModelMeshSpecification& modelSpec = {}, const TextureAttachmentSpecification& textureAtttachments = {});
         MeshComponent(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const std::string& registryId, 
@@ -39,20 +61,31 @@ namespace TWE {
         void setTexture(const TextureAttachmentSpecification& textureAtttachments);
         void setTexture(Texture* texture);
         void setTexture(std::shared_ptr<Texture> texture);
+        void setLODChain(std::shared_ptr<MeshLODChainSpecification> lodChain);
+        void setLODIndex(int lodIndex);
         [[nodiscard]] std::shared_ptr<VAO> getVAO() const noexcept;
         [[nodiscard]] std::shared_ptr<VBO> getVBO() const noexcept;
         [[nodiscard]] std::shared_ptr<EBO> getEBO() const noexcept;
         [[nodiscard]] std::shared_ptr<Texture> getTexture() const noexcept;
         [[nodiscard]] const std::string& getRegistryId() const noexcept;
         [[nodiscard]] const ModelMeshSpecification& getModelMeshSpecification() const noexcept;
+        [[nodiscard]] std::shared_ptr<MeshLODChainSpecification> getLODChain() const noexcept;
+        [[nodiscard]] int getLODIndex() const noexcept;
+        [[nodiscard]] bool getIsLODChainResolved() const noexcept;
     private:
-        void create(GLfloat* vertices, GLsizei vertSize, GLuint* indices, GLsizei indSize);
+        void create(GLfloat* vertices, GLsizei vertSize, void* indices, GLsizei indSize, GLenum indexType = GL_UNSIGNED_INT, 
+            const VertexLayout& layout = VertexLayout::createDefault(), bool ownsData = false);
+        void acquireAssetReference();
         std::shared_ptr<VAO> _vao;
         std::shared_ptr<VBO> _vbo;
         std::shared_ptr<EBO> _ebo;
         std::shared_ptr<Texture> _texture;
         std::string _registryId;
         ModelMeshSpecification _modelSpec;
+        std::shared_ptr<MeshLODChainSpecification> _lodChain;
+        std::shared_ptr<AssetReferenceSpecification> _assetReference;
+        int _lodIndex = 0;
+        bool _isLODChainResolved = false;
     };
 }
 
@@ -2,6 +2,8 @@
 #define MESH_RENDERER_COMPONENT_HPP
 
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include "string"
 
 #include "renderer/material.hpp"
@@ -13,20 +15,22 @@ namespace TWE {
         MeshRendererComponent();
         MeshRendererComponent(const char* vertexShaderPath, const char* fragmentShaderPath, int entityId, const std::string& registryId);
         MeshRendererComponent(const MeshRendererComponent& meshRendererComponent);
-        void updateMaterialUniform();
-        void updateMatsUniform(const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection, const glm::mat4& projectionView);
         void setShader(const char* vertexShaderPath, const char* fragmentShaderPath, const std::string& registryId);
         void setShader(std::shared_ptr<Shader> shader);
         void setMaterial(const Material& material);
         void setIs3D(bool is3D);
+        void setUniform(const std::string& name, const ShaderUniformValue& value);
         [[nodiscard]] int getEntityId() const noexcept;
         [[nodiscard]] bool getIs3D() const noexcept;
         [[nodiscard]] Material& getMaterial() noexcept;
         [[nodiscard]] std::shared_ptr<Shader> getShader() const noexcept;
         [[nodiscard]] const std::string& getRegistryId() const noexcept;
+        [[nodiscard]] std::shared_ptr<const std::vector<ShaderUniformSpecification>> getUniforms() const noexcept;
     private:
+        void createShader(const char* vertexShaderPath, const char* fragmentShaderPath);
         Material _material;
         std::shared_ptr<Shader> _shader;
+        std::shared_ptr<const std::vector<ShaderUniformSpecification>> _uniforms;
         std::string _registryId;
         int _entityId;
         bool _is3D;
@@ -5,6 +5,8 @@
 #include <glm/gtx/quaternion.hpp>
 #include <memory>
 #include <vector>
+#include <map>
+#include <tuple>
 #include "btBulletDynamicsCommon.h"
 #include "LinearMath/btTransform.h"
 #include "LinearMath/btVector3.h"
@@ -14,6 +16,7 @@
 #include "renderer/vao.hpp"
 #include "renderer/vbo.hpp"
 #include "renderer/ebo.hpp"
+#include "renderer/submesh-specification.hpp"
 
 namespace TWE {
     enum class ColliderType {
@@ -30,14 +33,22 @@ namespace TWE {
 
     struct TriangleMeshSpecification {
         TriangleMeshSpecification() = default;
-        TriangleMeshSpecification(std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo)
-            : vbo(vbo), ebo(ebo) {}
+        TriangleMeshSpecification(std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const SubmeshSpecification& submesh = {})
+            : vbo(vbo), ebo(ebo), submesh(submesh) {}
         TriangleMeshSpecification(const TriangleMeshSpecification& triangleMeshSpecification) {
             this->vbo = triangleMeshSpecification.vbo;
             this->ebo = triangleMeshSpecification.ebo;
+            this->submesh = triangleMeshSpecification.submesh;
         }
         std::shared_ptr<VBO> vbo = nullptr;
         std::shared_ptr<EBO> ebo = nullptr;
+        SubmeshSpecification submesh;
+    };
+
+    struct TriangleMeshShapeSpecification {
+        std::weak_ptr<VBO> vbo;
+        std::weak_ptr<EBO> ebo;
+        btBvhTriangleMeshShape* shape;
     };
 
     struct PhysicsUserPointer {
@@ -81,6 +92,8 @@ namespace TWE {
         static btCollisionShape* createShape(ColliderType colliderType, const glm::vec3& shapeSize);
         static btCollisionShape* createShape(ColliderType colliderType, TriangleMeshSpecification& triangleMeshSpecification);
     private:
+        static void releaseExpiredTriangleMeshShapes();
+        static std::map<std::tuple<const VBO*, const EBO*, int, int>, TriangleMeshShapeSpecification>* triangleMeshShapes;
         bool _needUpdate;
         btRigidBody* _rigidBody;
         ColliderType _colliderType;
@@ -8,6 +8,8 @@
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glad.h>
 
+#include "entt/entt.hpp"
+
 #include "twe-math/twe-math.hpp"
 
 namespace TWE {
@@ -39,24 +41,38 @@ namespace TWE {
         void setPosition(const glm::vec3& pos, bool acceptToChilds = true);
         void setRotation(float angle, const glm::vec3& axis, bool acceptToChilds = true);
         void setRotation(const glm::vec3& angles, bool acceptToChilds = true);
+        void setOrientation(const glm::quat& orientation, bool acceptToChilds = true);
         void setSize(const glm::vec3& size, bool acceptToChilds = true);
         [[nodiscard]] glm::mat4 getModel();
         [[nodiscard]] const ModelSpecification& getTransform() const noexcept;
         [[nodiscard]] const glm::vec3& getPosition() const noexcept;
         [[nodiscard]] const glm::vec3& getRotation() const noexcept;
+        [[nodiscard]] const glm::quat& getOrientation() const noexcept;
         [[nodiscard]] const glm::vec3& getSize() const noexcept;
         [[nodiscard]] glm::vec3 getForward();
         [[nodiscard]] glm::vec3 getRight();
         [[nodiscard]] glm::vec3 getUp();
     private:
         void setPreTransform(const ModelSpecification& preTransform);
+        void commitTransform();
+        void updateEuler() const noexcept;
+        void setWorldModel(const glm::mat4& model);
+        void setLocalModel(const glm::mat4& parentModel, entt::entity parent);
         [[nodiscard]] glm::vec3 getZeroRotationAroundPos(const glm::vec3& centerPosition);
         [[nodiscard]] const ModelSpecification& getPreTransform() const noexcept;
+        mutable ModelSpecification _transform;
+        ModelSpecification _preTransform;
+        glm::quat _orientation;
+        glm::quat _preOrientation;
         bool _needRecache;
+        mutable bool _needEulerUpdate;
+        bool _isDirty;
+        bool _keepChilds;
         glm::mat4 _model;
-        ModelSpecification _transform;
-        ModelSpecification _preTransform;
+        glm::mat4 _localModel;
+        entt::entity _parent;
         friend class Scene;
+        friend class TransformBatch;
         friend class SceneSerializer;
     };
 }
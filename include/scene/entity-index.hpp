@@ -0,0 +1,41 @@
+#ifndef ENTITY_INDEX_HPP
+#define ENTITY_INDEX_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <entt/entt.hpp>
+
+#include "scene/components/id-component.hpp"
+#include "scene/components/name-component.hpp"
+
+namespace TWE {
+    class EntityIndex {
+    public:
+        EntityIndex() = default;
+        ~EntityIndex();
+        void connect(entt::registry& registry);
+        void disconnect();
+        void rebuild();
+        [[nodiscard]] entt::entity findById(int id);
+        [[nodiscard]] entt::entity findByName(const std::string& name);
+        [[nodiscard]] std::vector<entt::entity> findAllByName(const std::string& name);
+    private:
+        void rebuildNames();
+        void onConstructID(entt::registry& registry, entt::entity entity);
+        void onUpdateID(entt::registry& registry, entt::entity entity);
+        void onDestroyID(entt::registry& registry, entt::entity entity);
+        void eraseID(entt::entity entity);
+        void onConstructName(entt::registry& registry, entt::entity entity);
+        void onUpdateName(entt::registry& registry, entt::entity entity);
+        void onDestroyName(entt::registry& registry, entt::entity entity);
+        void eraseName(entt::entity entity);
+        entt::registry* _registry = nullptr;
+        std::unordered_map<int, entt::entity> _ids;
+        std::unordered_map<entt::entity, int> _entityIds;
+        std::unordered_multimap<std::string, entt::entity> _names;
+        std::unordered_map<entt::entity, std::string> _entityNames;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -9,10 +9,13 @@
 #include "scene/iscene-scripts.hpp"
 #include "scene/iscene-audio.hpp"
 #include "scene/physics-raycast.hpp"
+#include "scene/system-scheduler.hpp"
+#include "scene/entity-index.hpp"
 
 #include "renderer/debug-camera.hpp"
 #include "stream/project-creator.hpp"
 #include "entity/entity.hpp"
+#include "entity/command-buffer.hpp"
 #include "undo-redo/ur-control.hpp"
 
 namespace TWE {
@@ -25,6 +28,7 @@ namespace TWE {
 
     struct SceneStateSpecification {
         entt::registry entityRegistry;
+        EntityIndex entityIndex;
         IScenePhysics* physics;
         URControl urControl;
         int lastId = 0;
@@ -47,8 +51,10 @@ namespace TWE {
         virtual void setScriptDLLRegistry(Registry<DLLLoadData>* scriptDLLRegistry) {}
         virtual void setProjectData(ProjectData* projectData) {}
         virtual void setState(SceneState state) {}
+        virtual void setRenderPath(RenderPath renderPath) {}
         virtual void cleanEntity(Entity& entity) {}
         virtual Entity createEntity(const std::string& name = "Entity") { return {}; }
+        virtual std::vector<Entity> createEntities(const std::vector<std::string>& names) { return {}; }
         virtual Entity copyEntityState(Entity& entity, SceneStateSpecification& to) { return {}; }
         [[nodiscard]] virtual bool getIsFocusedOnDebugCamera() const noexcept { return false; }
         [[nodiscard]] virtual entt::registry* getRegistry() const noexcept { return nullptr; }
@@ -62,8 +68,12 @@ namespace TWE {
         [[nodiscard]] virtual IScenePhysics* getScenePhysics() { return nullptr; }
         [[nodiscard]] virtual ProjectData* getProjectData() { return nullptr; }
         [[nodiscard]] virtual SceneCameraSpecification* getSceneCamera() { return nullptr; }
+        [[nodiscard]] virtual std::vector<SceneViewSpecification>* getSceneViews() { return nullptr; }
         [[nodiscard]] virtual SceneRegistrySpecification* getSceneRegistry() { return nullptr; }
+        [[nodiscard]] virtual SystemScheduler* getSystemScheduler(SceneState state) { return nullptr; }
+        [[nodiscard]] virtual CommandBuffer* getCommandBuffer() { return nullptr; }
         [[nodiscard]] virtual SceneState getSceneState() { return SceneState::Edit; }
+        [[nodiscard]] virtual RenderPath getRenderPath() const noexcept { return RenderPath::Forward; }
     private:
         std::string tempStr;
     };
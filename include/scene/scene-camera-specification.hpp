@@ -2,8 +2,10 @@
 #define SCENE_CAMERA_SPECIFICATION_HPP
 
 #include <glm/glm.hpp>
+#include <memory>
 
 #include "renderer/camera.hpp"
+#include "renderer/fbo.hpp"
 
 namespace TWE {
     struct SceneCameraSpecification {
@@ -15,6 +17,16 @@ namespace TWE {
         glm::mat4 view = glm::mat4(1.f);
         glm::mat4 projectionView = glm::mat4(1.f);
     };
+
+    struct SceneViewSpecification {
+        SceneViewSpecification() = default;
+        SceneViewSpecification(const SceneCameraSpecification& camera, std::shared_ptr<FBO> renderTarget, const glm::vec4& viewport, RenderPath renderPath)
+            : camera(camera), renderTarget(renderTarget), viewport(viewport), renderPath(renderPath) {}
+        SceneCameraSpecification camera;
+        std::shared_ptr<FBO> renderTarget;
+        glm::vec4 viewport = glm::vec4(0.f, 0.f, 1.f, 1.f);
+        RenderPath renderPath = RenderPath::Forward;
+    };
 }
 
 #endif
\ No newline at end of file
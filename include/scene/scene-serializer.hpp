@@ -5,6 +5,8 @@
 #include <iostream>
 #include <vector>
 #include <functional>
+#include <map>
+#include <filesystem>
 #include <single_include/nlohmann/json.hpp>
 
 #include "scene/iscene.hpp"
@@ -20,6 +22,7 @@ namespace TWE {
     public:
         static bool serialize(IScene* scene, const std::string& path, ProjectData* projectData);
         static bool deserialize(IScene* scene, const std::string& path, ProjectData* projectData);
+        [[nodiscard]] static bool isModifiedExternally(const std::string& path);
     private:
         static void serializeEntity(Entity& entity, nlohmann::json& jsonEntities, ProjectData* projectData, IScene* scene);
         static void serializeCreationTypeComponent(Entity& entity, nlohmann::json& jsonEntity);
@@ -50,6 +53,9 @@ namespace TWE {
         static void revalidateParentChildsComponent(IScene* scene);
 
         [[nodiscard]] static std::string deleteInvertedCommas(const std::string& str);
+        [[nodiscard]] static std::string getWriteTimeKey(const std::string& path);
+
+        static std::map<std::string, std::filesystem::file_time_type> writeTimes;
     };
 };
 
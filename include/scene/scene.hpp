@@ -12,6 +12,7 @@
 #include "scene/scene-physics.hpp"
 #include "scene/scene-scripts.hpp"
 #include "scene/scene-audio.hpp"
+#include "scene/transform-batch.hpp"
 
 #include "time.hpp"
 #include "input/input.hpp"
@@ -19,6 +20,22 @@
 #include "undo-redo/ur-control.hpp"
 
 namespace TWE {
+    struct TransformNodeSpecification {
+        TransformNodeSpecification(entt::entity entity, int parent, TransformComponent* transformComponent, ParentChildsComponent* parentChildsComponent,
+            PhysicsComponent* physicsComponent, AudioComponent* audioComponent)
+            : entity(entity), parent(parent), transformComponent(transformComponent), parentChildsComponent(parentChildsComponent),
+            physicsComponent(physicsComponent), audioComponent(audioComponent), model(1.f), isChanged(false), isPropagated(false) {}
+        entt::entity entity;
+        int parent;
+        TransformComponent* transformComponent;
+        ParentChildsComponent* parentChildsComponent;
+        PhysicsComponent* physicsComponent;
+        AudioComponent* audioComponent;
+        glm::mat4 model;
+        bool isChanged;
+        bool isPropagated;
+    };
+
     class Scene: public IScene {
     public:
         Scene();
@@ -30,8 +47,10 @@ namespace TWE {
         void setScriptDLLRegistry(Registry<DLLLoadData>* scriptDLLRegistry) override;
         void setProjectData(ProjectData* projectData) override;
         void setState(SceneState state) override;
+        void setRenderPath(RenderPath renderPath) override;
         void cleanEntity(Entity& entity) override;
         Entity createEntity(const std::string& name = "Entity") override;
+        std::vector<Entity> createEntities(const std::vector<std::string>& names) override;
         Entity copyEntityState(Entity& entity, SceneStateSpecification& to) override;
         [[nodiscard]] bool getIsFocusedOnDebugCamera() const noexcept override;
         [[nodiscard]] entt::registry* getRegistry() const noexcept override;
@@ -45,25 +64,45 @@ namespace TWE {
         [[nodiscard]] IScenePhysics* getScenePhysics() override;
         [[nodiscard]] ProjectData* getProjectData() override;
         [[nodiscard]] SceneCameraSpecification* getSceneCamera() override;
+        [[nodiscard]] std::vector<SceneViewSpecification>* getSceneViews() override;
         [[nodiscard]] SceneRegistrySpecification* getSceneRegistry() override;
+        [[nodiscard]] SystemScheduler* getSystemScheduler(SceneState state) override;
+        [[nodiscard]] CommandBuffer* getCommandBuffer() override;
         [[nodiscard]] SceneState getSceneState() override;
+        [[nodiscard]] RenderPath getRenderPath() const noexcept override;
     private:
+        void registerSystems();
         void updateEditState();
         void updateTransforms();
-        void updateChildsTransform(Entity& entity, ModelSpecification& ratioTransform, const glm::vec3& centerPositon);
+        void buildTransformHierarchy();
+        void connectTransformHierarchy(entt::registry& registry);
+        void invalidateTransformHierarchy(entt::registry& registry, entt::entity entity);
+        void updatePhysicsTransform(PhysicsComponent& physicsComponent, const TransformComponent& transformComponent, const glm::vec3& positionDelta, 
+            const glm::vec3& sizeDelta, bool isRotated);
         void updateRunState();
-        void updateLight();
         bool updateView();
-        void resetEntityRegistry(entt::registry* registry);
-        void setLight(const LightComponent& light, TransformComponent& transform, const glm::mat4& lightSpaceMat, const uint32_t index);
-        void setLight(const LightComponent& light, TransformComponent& transform, const uint32_t index);
+        void setSceneCamera(SceneCameraSpecification& sceneCamera, Camera* camera, const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up);
+        [[nodiscard]] static int getViewOrder(const SceneViewSpecification& sceneView);
+        void resetEntityRegistry(SceneStateSpecification& sceneState);
         void copySceneState(SceneStateSpecification& from, SceneStateSpecification& to);
+        void copyScriptComponent(ScriptComponent& scriptComponent, entt::registry& to, entt::entity instance, std::map<std::string, PVoid>& behaviorFactories);
+        void copyPhysicsComponent(PhysicsComponent& physicsComponent, SceneStateSpecification& to, entt::entity instance);
+        void copyAudioComponent(AudioComponent& audioComponent, entt::registry& to, entt::entity instance);
+        template<typename T>
+        void copyComponents(entt::registry& from, entt::registry& to);
 
         SceneState _sceneState;
+        RenderPath _renderPath;
         SceneCameraSpecification _sceneCamera;
+        std::vector<SceneViewSpecification> _sceneViews;
+        std::vector<TransformNodeSpecification> _transformNodes;
+        bool _isTransformHierarchyDirty;
         SceneRegistrySpecification _sceneRegistry;
         std::unique_ptr<ISceneAudio> _sceneAudio;
         std::unique_ptr<ISceneScripts> _sceneScripts;
+        SystemScheduler _editSystems;
+        SystemScheduler _runSystems;
+        std::unique_ptr<CommandBuffer> _commandBuffer;
 
         DebugCamera* _debugCamera;
         bool _isFocusedOnDebugCamera;
@@ -71,6 +110,13 @@ namespace TWE {
         Registry<DLLLoadData>* _scriptDLLRegistry;
         ProjectData* _projectData;
     };
+
+    template<typename T>
+    void Scene::copyComponents(entt::registry& from, entt::registry& to) {
+        auto view = from.view<T>();
+        for(int i = static_cast<int>(view.size()) - 1; i >= 0; --i)
+            to.emplace<T>(view[i], from.get<T>(view[i]));
+    }
 }
 
 #endif
\ No newline at end of file
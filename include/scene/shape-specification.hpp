@@ -26,6 +26,7 @@ namespace TWE {
         EntityCreationType creationType;
         ModelMeshSpecification modelSpec;
         std::string meshId;
+        std::shared_ptr<MeshLODChainSpecification> lodChain;
     };
 
     struct MeshRendererSpecification {
@@ -3,14 +3,19 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <exception>
+#include <algorithm>
 #include <entt/entt.hpp>
 
 #include "scene/iscene.hpp"
 #include "scene/components/components.hpp"
 #include "scene/shape-specification.hpp"
+#include "scene/asset-manager.hpp"
 #include "model-loader/model-loader.hpp"
 #include "renderer/renderer.hpp"
 #include "registry/registry.hpp"
+#include "jobs/job-system.hpp"
 
 namespace TWE {
     class Shape{
@@ -30,10 +35,19 @@ namespace TWE {
         static Entity createModelEntity(IScene* scene, const std::filesystem::path& modelPath, int index);
         static MeshSpecification* registerMeshSpecification(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, EntityCreationType creationType, 
             const std::string& id, const ModelMeshSpecification& modelSpec = {});
+        static void registerModels(const std::vector<std::filesystem::path>& modelPaths);
+        static bool reloadModel(IScene* scene, const std::filesystem::path& modelPath);
+        [[nodiscard]] static bool hasModel(const std::filesystem::path& modelPath);
+        [[nodiscard]] static bool isModelResident(const std::filesystem::path& modelPath);
+        static MeshSpecification* getMeshSpecification(const std::string& meshId);
         static MeshRendererSpecification* registerMeshRendererSpecification(const std::string& vertexShaderPath, const std::string& fragmentShaderPath, const std::string& id);
         static ShapeSpecification* shapeSpec;
     private:
         static bool registerModel(const std::filesystem::path& modelPath);
+        static bool registerModelData(ModelLoaderData* modelLoaderData);
+        static MeshSpecification* findModelMeshSpecification(const std::filesystem::path& modelPath, int index);
+        static std::shared_ptr<MeshLODChainSpecification> createLODChain(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, 
+            const std::vector<MeshLODDataSpecification>& lods = {}, const MeshBoundsSpecification& bounds = {});
         static void fillMeshRegistry();
         static void fillMeshRendererRegistry();
         static float cubeVertices[];
@@ -0,0 +1,67 @@
+#ifndef SYSTEM_SCHEDULER_HPP
+#define SYSTEM_SCHEDULER_HPP
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+#include <mutex>
+#include <algorithm>
+#include <entt/entt.hpp>
+
+#include "jobs/job-system.hpp"
+
+namespace TWE {
+    class IScene;
+
+    enum class SystemAccess {
+        Shared,
+        Exclusive
+    };
+
+    struct SystemSpecification {
+        SystemSpecification(const std::string& name, const std::function<void(IScene*)>& update, const std::vector<entt::id_type>& reads,
+            const std::vector<entt::id_type>& writes, SystemAccess access)
+            : name(name), update(update), reads(reads), writes(writes), access(access), time(0.f), isEnabled(true) {}
+        std::string name;
+        std::function<void(IScene*)> update;
+        std::vector<entt::id_type> reads;
+        std::vector<entt::id_type> writes;
+        SystemAccess access;
+        float time;
+        bool isEnabled;
+    };
+
+    class SystemScheduler {
+    public:
+        void add(const std::string& name, const std::function<void(IScene*)>& update, const std::vector<entt::id_type>& reads = {},
+            const std::vector<entt::id_type>& writes = {}, SystemAccess access = SystemAccess::Shared);
+        void remove(const std::string& name);
+        void setIsEnabled(const std::string& name, bool isEnabled);
+        void run(IScene* scene);
+        template<typename... Types>
+        [[nodiscard]] static std::vector<entt::id_type> types();
+        [[nodiscard]] const std::vector<SystemSpecification>& getSystems() const noexcept;
+        [[nodiscard]] float getTime() const noexcept;
+    private:
+        void buildGraph();
+        [[nodiscard]] static bool isConflicting(const SystemSpecification& first, const SystemSpecification& second);
+        [[nodiscard]] static bool isIntersecting(const std::vector<entt::id_type>& first, const std::vector<entt::id_type>& second);
+        static void execute(SystemSpecification& system, IScene* scene);
+        std::vector<SystemSpecification> _systems;
+        std::vector<std::vector<size_t>> _dependencies;
+        std::vector<JobHandle> _jobs;
+        std::vector<std::function<void()>> _pendingChanges;
+        std::mutex _pendingMutex;
+        float _time = 0.f;
+        bool _isDirty = true;
+        bool _isRunning = false;
+    };
+
+    template<typename... Types>
+    std::vector<entt::id_type> SystemScheduler::types() {
+        return { entt::type_hash<Types>::value()... };
+    }
+}
+
+#endif
\ No newline at end of file
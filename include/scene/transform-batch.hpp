@@ -0,0 +1,29 @@
+#ifndef TRANSFORM_BATCH_HPP
+#define TRANSFORM_BATCH_HPP
+
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define TWE_TRANSFORM_BATCH_SSE
+    #include <xmmintrin.h>
+#endif
+
+#include "scene/components/transform-component.hpp"
+
+namespace TWE {
+    class TransformBatch {
+    public:
+        static void submit(TransformComponent& transformComponent);
+        static void compute();
+        [[nodiscard]] static size_t getCount() noexcept;
+    private:
+        static void computeRange(size_t begin, size_t end);
+        static std::vector<TransformComponent*> transforms;
+        static std::vector<float> positions[3];
+        static std::vector<float> orientations[4];
+        static std::vector<float> sizes[3];
+        static size_t count;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef CACHE_DIRECTORY_HPP
+#define CACHE_DIRECTORY_HPP
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+#include <filesystem>
+
+namespace TWE {
+    class CacheDirectory {
+    public:
+        [[nodiscard]] static std::filesystem::path getPath(const std::string& category);
+        [[nodiscard]] static std::filesystem::path getFilePath(const std::string& category, const std::string& key, const std::string& extension);
+        static const std::filesystem::path rootPath;
+    };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef DIRECTORY_MODEL_HPP
+#define DIRECTORY_MODEL_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+
+#include "stream/file-watcher.hpp"
+
+namespace TWE {
+    struct DirectoryEntrySpecification {
+        DirectoryEntrySpecification() = default;
+        DirectoryEntrySpecification(const std::string& fileName, bool isDirectory)
+            : fileName(fileName), isDirectory(isDirectory) {}
+        std::string fileName;
+        bool isDirectory = false;
+    };
+
+    class DirectoryModel {
+    public:
+        void setRootPath(const std::filesystem::path& rootPath);
+        [[nodiscard]] std::vector<FileWatchEventSpecification> update();
+        void invalidate();
+        [[nodiscard]] const std::vector<DirectoryEntrySpecification>& getEntries(const std::filesystem::path& directory);
+        [[nodiscard]] const std::filesystem::path& getRootPath() const noexcept;
+        static const std::chrono::milliseconds rescanInterval;
+    private:
+        void insert(const std::filesystem::path& path);
+        void erase(const std::filesystem::path& path);
+        [[nodiscard]] static std::filesystem::path getKey(const std::filesystem::path& path);
+        [[nodiscard]] static bool compareEntries(const DirectoryEntrySpecification& left, const DirectoryEntrySpecification& right);
+        std::map<std::filesystem::path, std::vector<DirectoryEntrySpecification>> _directories;
+        std::filesystem::path _rootPath;
+        FileWatcher _watcher;
+        std::chrono::steady_clock::time_point _lastRescan;
+    };
+}
+
+#endif
\ No newline at end of file
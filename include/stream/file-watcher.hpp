@@ -0,0 +1,71 @@
+#ifndef FILE_WATCHER_HPP
+#define FILE_WATCHER_HPP
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) && !defined(__CYGWIN__)
+#ifndef TWE_PLATFORM_WINDOWS
+#define TWE_PLATFORM_WINDOWS
+#endif
+#include "windows.h"
+#elif defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#endif
+
+#include <map>
+#include <vector>
+#include <string>
+#include <filesystem>
+#include <cstdint>
+
+namespace TWE {
+    enum class FileWatchEventType {
+        Created,
+        Removed,
+        Modified,
+        Renamed,
+        Rescan
+    };
+
+    struct FileWatchEventSpecification {
+        FileWatchEventSpecification() = default;
+        FileWatchEventSpecification(FileWatchEventType type, const std::filesystem::path& path, const std::filesystem::path& oldPath = {})
+            : type(type), path(path), oldPath(oldPath) {}
+        FileWatchEventType type = FileWatchEventType::Modified;
+        std::filesystem::path path;
+        std::filesystem::path oldPath;
+    };
+
+    class FileWatcher {
+    public:
+        FileWatcher() = default;
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+        ~FileWatcher();
+        bool watch(const std::filesystem::path& rootPath);
+        void stop();
+        [[nodiscard]] std::vector<FileWatchEventSpecification> poll();
+        [[nodiscard]] bool isWatching() const noexcept;
+        [[nodiscard]] const std::filesystem::path& getRootPath() const noexcept;
+    private:
+        std::filesystem::path _rootPath;
+        #ifdef TWE_PLATFORM_WINDOWS
+        bool read();
+        HANDLE _directory = INVALID_HANDLE_VALUE;
+        OVERLAPPED _overlapped = {};
+        std::vector<DWORD> _buffer;
+        bool _isPending = false;
+        #elif defined(__linux__)
+        void addWatch(const std::filesystem::path& directory);
+        void addWatches(const std::filesystem::path& directory, std::vector<FileWatchEventSpecification>* events);
+        void moveWatches(const std::filesystem::path& oldPath, const std::filesystem::path& newPath);
+        void removeWatches(const std::filesystem::path& directory);
+        int _file = -1;
+        std::map<int, std::filesystem::path> _watches;
+        std::vector<uint8_t> _buffer;
+        #endif
+    };
+}
+
+#endif
\ No newline at end of file
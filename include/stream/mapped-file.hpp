@@ -0,0 +1,45 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#if defined(WIN32) || defined(_WIN32) || defined(__WIN32) && !defined(__CYGWIN__)
+#ifndef TWE_PLATFORM_WINDOWS
+#define TWE_PLATFORM_WINDOWS
+#endif
+#include "windows.h"
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <integer.hpp>
+#include <cstdint>
+#include <filesystem>
+
+namespace TWE {
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        MappedFile(const std::filesystem::path& filePath);
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+        bool open(const std::filesystem::path& filePath);
+        void close();
+        [[nodiscard]] bool isOpen() const noexcept;
+        [[nodiscard]] const uint8_t* getData() const noexcept;
+        [[nodiscard]] size_t getSize() const noexcept;
+    private:
+        #ifdef TWE_PLATFORM_WINDOWS
+        HANDLE _file = INVALID_HANDLE_VALUE;
+        HANDLE _mapping = nullptr;
+        #else
+        int _file = -1;
+        #endif
+        const uint8_t* _data = nullptr;
+        size_t _size = 0;
+    };
+}
+
+#endif
\ No newline at end of file
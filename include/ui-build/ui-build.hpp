@@ -7,14 +7,26 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 #include <imgui_internal.h>
+#include <vector>
 
 namespace TWE {
+    struct UIDrawDataSpecification {
+        ImDrawData drawData;
+        std::vector<ImDrawList*> drawLists;
+    };
+
     class UIBuild {
     public:
         UIBuild(GLFWwindow *window);
         ~UIBuild();
         void begin();
         void end();
+        void newFrame();
+        void capture(int index);
+        void render(int index);
+    private:
+        void releaseDrawLists(UIDrawDataSpecification& frame);
+        UIDrawDataSpecification _frames[2];
     };
 }
 
@@ -0,0 +1,38 @@
+#version 330 core
+
+layout (location = 0) out vec4 outColor;
+layout (location = 1) out int outId;
+
+uniform sampler2D textures[16];
+
+in vec2 texCoord;
+in vec4 objColor;
+flat in int slot;
+flat in int id;
+
+vec4 sampleTexture() {
+    switch(slot) {
+        case 0: return texture(textures[0], texCoord);
+        case 1: return texture(textures[1], texCoord);
+        case 2: return texture(textures[2], texCoord);
+        case 3: return texture(textures[3], texCoord);
+        case 4: return texture(textures[4], texCoord);
+        case 5: return texture(textures[5], texCoord);
+        case 6: return texture(textures[6], texCoord);
+        case 7: return texture(textures[7], texCoord);
+        case 8: return texture(textures[8], texCoord);
+        case 9: return texture(textures[9], texCoord);
+        case 10: return texture(textures[10], texCoord);
+        case 11: return texture(textures[11], texCoord);
+        case 12: return texture(textures[12], texCoord);
+        case 13: return texture(textures[13], texCoord);
+        case 14: return texture(textures[14], texCoord);
+        case 15: return texture(textures[15], texCoord);
+    }
+    return vec4(1.0);
+}
+
+void main(){
+    outColor = sampleTexture() * objColor;
+    outId = id;
+}
\ No newline at end of file
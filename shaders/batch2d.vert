@@ -0,0 +1,20 @@
+#version 330 core
+
+layout (location = 0) in vec3 pos;
+layout (location = 1) in vec2 textureCoord;
+layout (location = 2) in vec4 color;
+layout (location = 3) in float textureSlot;
+layout (location = 4) in int entityId;
+
+out vec2 texCoord;
+out vec4 objColor;
+flat out int slot;
+flat out int id;
+
+void main() {
+   gl_Position = vec4(pos, 1.0);
+   texCoord = textureCoord;
+   objColor = color;
+   slot = int(textureSlot);
+   id = entityId;
+}
\ No newline at end of file
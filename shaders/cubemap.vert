@@ -7,8 +7,11 @@ out vec3 texCoord;
 uniform mat4 view = mat4(1.0f);
 uniform mat4 projection = mat4(1.0f);
 uniform mat4 model = mat4(1.0f);
+uniform vec3 posScale = vec3(1.0f);
+uniform vec3 posOffset = vec3(0.0f);
 
 void main() {
-   gl_Position = projection * mat4(mat3(view)) * model * vec4(pos, 1.0f);
-   texCoord = pos;
+   vec3 position = pos * posScale + posOffset;
+   gl_Position = projection * mat4(mat3(view)) * model * vec4(position, 1.0f);
+   texCoord = position;
 }
\ No newline at end of file
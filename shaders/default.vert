@@ -13,10 +13,13 @@ uniform mat4 model = mat4(1.0f);
 uniform mat4 view = mat4(1.0f);
 uniform mat4 projection = mat4(1.0f);
 uniform mat4 mvp = mat4(1.0f);
+uniform vec3 posScale = vec3(1.0f);
+uniform vec3 posOffset = vec3(0.0f);
 
 void main() {
-   gl_Position = mvp * vec4(pos, 1.0);
-   fragPos = vec3(model * vec4(pos, 1.0f));
+   vec3 position = pos * posScale + posOffset;
+   gl_Position = mvp * vec4(position, 1.0);
+   fragPos = vec3(model * vec4(position, 1.0f));
    normal = mat3(transpose(inverse(model))) * normalVecs;
    texCoord = textureCoord;
 }
\ No newline at end of file
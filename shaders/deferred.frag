@@ -0,0 +1,126 @@
+#version 330 core
+
+struct Fading {
+    float constant;
+    float linear;
+    float quadratic;
+};
+
+struct LightType {
+    bool spot;
+    bool point;
+    bool dir;
+};
+
+struct Light {
+    vec3 direction;
+    vec3 pos;
+    vec3 color;
+    float cutOff;
+    float outerCutOff;
+    Fading fading;
+    LightType type;
+    sampler2D shadowMap;
+    mat4 lightSpaceMat;
+    bool castShadows;
+};
+
+struct Surface {
+    vec3 fragPos;
+    vec3 normal;
+    float ambient;
+    float diffuse;
+    float specular;
+    float shininess;
+};
+
+layout (location = 0) out vec4 color;
+layout (location = 1) out int outId;
+
+uniform sampler2D albedoMap;
+uniform isampler2D idMap;
+uniform sampler2D normalMap;
+uniform sampler2D materialMap;
+uniform sampler2D depthMap;
+uniform vec2 viewportOffset = vec2(0.f, 0.f);
+uniform vec2 viewportSize = vec2(1.f, 1.f);
+uniform mat4 inverseProjectionView = mat4(1.0f);
+uniform vec3 viewPos = vec3(0.f, 0.f, 0.f);
+uniform bool isBasePass = true;
+uniform Light light;
+
+vec3 calculateDiffuse(Surface surface, vec3 lightDir) {
+    float diffuse = max(dot(surface.normal, lightDir), 0.f);
+    return (diffuse * surface.diffuse) * light.color;
+}
+
+vec3 calculateSpecular(Surface surface, vec3 lightDir, vec3 viewDir) {
+    vec3 reflectDir = reflect(-lightDir, surface.normal);
+    float spec = pow(max(dot(viewDir, reflectDir), 0.f), surface.shininess);
+    return surface.specular * spec * light.color;
+}
+
+vec3 calculateAmbient(Surface surface) {
+    return vec3(surface.diffuse) * surface.ambient;
+}
+
+float calculateFading(Surface surface) {
+    float distan = length(light.pos - surface.fragPos);
+    return 1.f / (light.fading.constant + light.fading.linear * distan + light.fading.quadratic * (distan * distan));
+}
+
+float calculateShadow(vec4 fragPosLightSpace) {
+    vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
+    projCoords = projCoords * 0.5f + 0.5f;
+    if(projCoords.z > 1.f)
+        return 0.f;
+    float shadow = 0.f;
+    vec2 texelSize = 1.f / textureSize(light.shadowMap, 0);
+    for(int x = -1; x <= 1; ++x)
+        for(int y = -1; y <= 1; ++y)
+            shadow += projCoords.z > texture(light.shadowMap, projCoords.xy + vec2(x, y) * texelSize).r ? 0.8f : 0.f;
+    return shadow / 9.f;
+}
+
+vec3 calculateLight(Surface surface, vec3 viewDir) {
+    vec3 ambient = calculateAmbient(surface);
+    if(light.type.dir) {
+        vec3 lightDir = normalize(-light.direction);
+        vec3 diffuse = calculateDiffuse(surface, lightDir);
+        vec3 specular = calculateSpecular(surface, lightDir, viewDir);
+        float shadow = light.castShadows ? calculateShadow(light.lightSpaceMat * vec4(surface.fragPos, 1.f)) : 0.f;
+        if(shadow != 0.f)
+            specular = vec3(0.f, 0.f, 0.f);
+        return ambient + (1.f - shadow) * (diffuse + specular);
+    }
+    vec3 lightDir = normalize(light.pos - surface.fragPos);
+    float fading = calculateFading(surface);
+    float intensity = 1.f;
+    if(light.type.spot) {
+        float theta = dot(lightDir, normalize(-light.direction));
+        intensity = clamp((theta - light.outerCutOff) / (light.cutOff - light.outerCutOff), 0.f, 1.f);
+    }
+    vec3 diffuse = calculateDiffuse(surface, lightDir) * intensity;
+    vec3 specular = calculateSpecular(surface, lightDir, viewDir) * intensity;
+    return (ambient + diffuse + specular) * fading;
+}
+
+void main() {
+    ivec2 texel = ivec2(gl_FragCoord.xy - viewportOffset);
+    float depth = texelFetch(depthMap, texel, 0).r;
+    if(depth == 1.f)
+        discard;
+    gl_FragDepth = depth;
+    outId = texelFetch(idMap, texel, 0).r;
+    if(isBasePass) {
+        color = vec4(0.f, 0.f, 0.f, 1.f);
+        return;
+    }
+    vec2 uv = (gl_FragCoord.xy - viewportOffset) / viewportSize;
+    vec4 position = inverseProjectionView * vec4(vec3(uv, depth) * 2.f - 1.f, 1.f);
+    vec4 normalShininess = texelFetch(normalMap, texel, 0);
+    vec4 materialParams = texelFetch(materialMap, texel, 0);
+    Surface surface = Surface(position.xyz / position.w, normalize(normalShininess.xyz), materialParams.x, materialParams.y, materialParams.z, normalShininess.w);
+    vec3 viewDir = normalize(viewPos - surface.fragPos);
+    color = vec4(calculateLight(surface, viewDir) * texelFetch(albedoMap, texel, 0).rgb, 0.f);
+}
\ No newline at end of file
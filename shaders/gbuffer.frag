@@ -0,0 +1,33 @@
+#version 330 core
+
+struct Material {
+    vec3 objColor;
+    float ambient;
+    float diffuse;
+    float specular;
+    float shininess;
+};
+
+layout (location = 0) out vec4 outAlbedo;
+layout (location = 1) out int outId;
+layout (location = 2) out vec4 outNormal;
+layout (location = 3) out vec4 outMaterial;
+
+in vec3 fragPos;
+in vec3 normal;
+in vec2 texCoord;
+
+uniform bool hasTexture = false;
+uniform sampler2D textureImg;
+uniform Material material;
+uniform int id = -1;
+
+void main() {
+    vec3 albedo = material.objColor;
+    if(hasTexture)
+        albedo *= texture(textureImg, texCoord).rgb;
+    outAlbedo = vec4(albedo, 1.f);
+    outId = id;
+    outNormal = vec4(normalize(normal), material.shininess);
+    outMaterial = vec4(material.ambient, material.diffuse, material.specular, 1.f);
+}
\ No newline at end of file
@@ -6,8 +6,10 @@ layout (location = 2) in vec2 textureCoord;
 out vec2 texCoord;
 
 uniform mat4 model = mat4(1.0f);
+uniform vec3 posScale = vec3(1.0f);
+uniform vec3 posOffset = vec3(0.0f);
 
 void main() {
-   gl_Position = model * vec4(pos, 1.0);
+   gl_Position = model * vec4(pos * posScale + posOffset, 1.0);
    texCoord = textureCoord;
 }
\ No newline at end of file
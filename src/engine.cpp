@@ -13,6 +13,7 @@ namespace TWE {
     std::unique_ptr<GUI> Engine::gui;
     #else
     std::unique_ptr<UIBuild> Engine::uiBuild;
+    std::unique_ptr<RenderThread> Engine::renderThread;
     #endif
 
     Engine::Engine(int wndWidth, int wndHeight, const char* title, GLFWmonitor* monitor, GLFWwindow* share) {
@@ -25,6 +26,7 @@ namespace TWE {
         window->setWindowCloseCallback(&Engine::windowCloseCallback);
         window->initGLAD(wndWidth, wndHeight);
         window->initFBO(wndWidth, wndHeight);
+        JobSystem::init();
         std::filesystem::path rootPath;
         //imgui
         #ifndef TWE_BUILD
@@ -51,6 +53,9 @@ namespace TWE {
         Shape::initialize(&meshRegistry, &meshRendererRegistry, &textureRegistry, rootPath);
         Input::setWindow(window->getSource());
         Renderer::init();
+        Renderer2D::init(rootPath);
+        DeferredRenderer::init(rootPath);
+        UploadManager::init();
         window->setVSync(false);
     }
 
@@ -115,8 +120,15 @@ namespace TWE {
     }
 
     void Engine::framebufferSizeCallback(GLFWwindow* windowA, int width, int height) {
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        JobSystem::runOnMainThread([width, height]() {
+            Renderer::setViewport(0, 0, width, height);
+            window->getFrameBuffer()->resize(width, height);
+        });
+        #else
         Renderer::setViewport(0, 0, width, height);
         window->getFrameBuffer()->resize(width, height);
+        #endif
     }
 
     void Engine::windowCloseCallback(GLFWwindow* glfwWindow) {
@@ -156,9 +168,21 @@ namespace TWE {
         #ifdef TWE_BUILD
         loadBuild(buildFilePath);
         #endif
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        startPipelined();
+        #else
         while(!window->getWindowShouldClose()){
             Renderer::cleanScreen({0.25f, 0.25f, 0.25f, 0.f});
             window->pollEvents();
+            #ifndef TWE_BUILD
+            ShaderCache::update();
+            #endif
+            TextureStreamer::update();
+            RenderTargetPool::update();
+            DynamicResolution::update();
+            UploadManager::update();
+            AssetManager::update();
+            JobSystem::executeMainThreadJobs();
             updateTitle();
             updateInput();
             render();
@@ -166,6 +190,8 @@ namespace TWE {
             Time::calculate();
             Input::flush();
         }
+        #endif
+        JobSystem::shutdown();
     }
 
     void Engine::render() {
@@ -183,7 +209,9 @@ namespace TWE {
             return;
         }
         Renderer::setViewport(0, 0, fboSize.width, fboSize.height);
+        DynamicResolution::beginGPUTimer();
         Renderer::renderScene(curScene.get());
+        DynamicResolution::endGPUTimer();
         frameBuffer->unbind();
         gui->end();
         #else
@@ -193,13 +221,67 @@ namespace TWE {
             uiBuild->end();
             return;
         }
-        Renderer::setViewport(0, 0, fboSize.width, fboSize.height);
-        Renderer::renderScene(curScene.get());
+        renderScaled([]() { Renderer::renderScene(curScene.get()); });
         uiBuild->end();
         #endif
     }
 
     #ifdef TWE_BUILD
+    void Engine::startPipelined() {
+        renderThread = std::make_unique<RenderThread>(window->getSource(), [this](int frameIndex) { renderFrame(frameIndex); });
+        while(!window->getWindowShouldClose()){
+            window->pollEvents();
+            AssetManager::update();
+            updateTitle();
+            updateInput();
+            int frameIndex = renderThread->getCaptureIndex();
+            uiBuild->newFrame();
+            curScene->update();
+            if(curScene->getSceneCamera()->camera)
+                Renderer::captureScene(curScene.get(), renderThread->getSnapshot(frameIndex));
+            uiBuild->capture(frameIndex);
+            renderThread->submit();
+            Time::calculate();
+            Input::flush();
+        }
+        renderThread.reset();
+    }
+
+    void Engine::renderFrame(int frameIndex) {
+        Renderer::cleanScreen({0.25f, 0.25f, 0.25f, 0.f});
+        TextureStreamer::update();
+        RenderTargetPool::update();
+        DynamicResolution::update();
+        UploadManager::update();
+        auto& snapshot = renderThread->getSnapshot(frameIndex);
+        if(!snapshot.views.empty())
+            renderScaled([&]() { Renderer::renderSnapshot(snapshot); });
+        uiBuild->render(frameIndex);
+        window->swapBuffers();
+    }
+
+    void Engine::renderScaled(const std::function<void()>& renderScene) {
+        auto& fboSize = window->getFrameBuffer()->getSize();
+        auto renderSize = DynamicResolution::getScaledSize(fboSize.width, fboSize.height);
+        if(renderSize.width == fboSize.width && renderSize.height == fboSize.height) {
+            Renderer::setViewport(0, 0, fboSize.width, fboSize.height);
+            DynamicResolution::beginGPUTimer();
+            renderScene();
+            DynamicResolution::endGPUTimer();
+            return;
+        }
+        static const FBOAttachmentSpecification renderTargetAttachments = { FBOTextureFormat::RGBA8, FBOTextureFormat::DEPTH24STENCIL8 };
+        auto renderTarget = RenderTargetPool::acquire(renderSize.width, renderSize.height, renderTargetAttachments);
+        renderTarget->bind();
+        Renderer::cleanScreen({0.25f, 0.25f, 0.25f, 0.f});
+        Renderer::setViewport(0, 0, renderSize.width, renderSize.height);
+        DynamicResolution::beginGPUTimer();
+        renderScene();
+        DynamicResolution::endGPUTimer();
+        renderTarget->blit(0, fboSize.width, fboSize.height);
+        Renderer::setViewport(0, 0, fboSize.width, fboSize.height);
+    }
+
     void Engine::loadBuild(const std::string& buildFilePath) {
         auto buildData = BuildCreator::load(buildFilePath);
         if(buildData) {
@@ -0,0 +1,88 @@
+#include "entity/command-buffer.hpp"
+#include "scene/iscene.hpp"
+
+namespace TWE {
+    CommandBuffer::CommandBuffer(IScene* scene): _scene(scene) {
+        for(uint32_t i = 0; i < JobSystem::getWorkerCount() + 2; ++i)
+            _queues.push_back(std::make_unique<CommandQueueSpecification>());
+    }
+
+    void CommandBuffer::createEntity(const std::string& name, const std::function<void(Entity&)>& onCreate) {
+        auto& queue = getQueue();
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.creates.push_back({ name, onCreate });
+    }
+
+    void CommandBuffer::destroy(const Entity& entity) {
+        auto& queue = getQueue();
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.destroys.push_back(entity.getSource());
+    }
+
+    void CommandBuffer::execute() {
+        merge();
+        auto& registry = _scene->getSceneRegistry()->current->entityRegistry;
+        if(!_commands.creates.empty()) {
+            std::vector<std::string> names;
+            names.reserve(_commands.creates.size());
+            for(auto& command : _commands.creates)
+                names.push_back(command.name);
+            auto entities = _scene->createEntities(names);
+            for(size_t i = 0; i < entities.size(); ++i)
+                if(_commands.creates[i].onCreate)
+                    _commands.creates[i].onCreate(entities[i]);
+        }
+        executeComponentCommands(registry, _commands.adds);
+        executeComponentCommands(registry, _commands.removes);
+        std::sort(_commands.destroys.begin(), _commands.destroys.end());
+        _commands.destroys.erase(std::unique(_commands.destroys.begin(), _commands.destroys.end()), _commands.destroys.end());
+        for(auto source : _commands.destroys) {
+            if(!registry.valid(source) || !registry.any_of<IDComponent>(source))
+                continue;
+            Entity entity { source, _scene };
+            _scene->cleanEntity(entity);
+        }
+        _commands.creates.clear();
+        _commands.adds.clear();
+        _commands.removes.clear();
+        _commands.destroys.clear();
+    }
+
+    void CommandBuffer::clear() {
+        for(auto& queue : _queues) {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            queue->creates.clear();
+            queue->adds.clear();
+            queue->removes.clear();
+            queue->destroys.clear();
+        }
+    }
+
+    CommandQueueSpecification& CommandBuffer::getQueue() {
+        size_t index = static_cast<size_t>(JobSystem::getThreadIndex() + 1);
+        return index < _queues.size() ? *_queues[index] : *_queues[0];
+    }
+
+    void CommandBuffer::merge() {
+        for(auto& queue : _queues) {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            std::move(queue->creates.begin(), queue->creates.end(), std::back_inserter(_commands.creates));
+            std::move(queue->adds.begin(), queue->adds.end(), std::back_inserter(_commands.adds));
+            std::move(queue->removes.begin(), queue->removes.end(), std::back_inserter(_commands.removes));
+            _commands.destroys.insert(_commands.destroys.end(), queue->destroys.begin(), queue->destroys.end());
+            queue->creates.clear();
+            queue->adds.clear();
+            queue->removes.clear();
+            queue->destroys.clear();
+        }
+    }
+
+    void CommandBuffer::executeComponentCommands(entt::registry& registry, std::vector<ComponentCommandSpecification>& commands) {
+        std::stable_sort(commands.begin(), commands.end(), [](const ComponentCommandSpecification& first, const ComponentCommandSpecification& second) {
+            return first.type < second.type;
+        });
+        for(auto& command : commands)
+            if(registry.valid(command.entity))
+                command.apply(registry, command.entity);
+    }
+}
\ No newline at end of file
@@ -260,10 +260,12 @@ namespace TWE {
                 if(meshIndex != -1) {
                     auto newState = meshComponent;
                     std::string meshId = meshRegistryKeys[meshIndex];
-                    auto meshSpecification = Shape::shapeSpec->meshRegistry->get(meshId);
-                    newState.setMesh(meshSpecification->vao, meshSpecification->vbo, meshSpecification->ebo, meshId, meshSpecification->modelSpec);
-                    _guiState->selectedEntity.getComponent<CreationTypeComponent>().setType(meshSpecification->creationType);
-                    _guiState->scene->getSceneRegistry()->current->urControl.execute(new ChangeMeshComponentStateCommand(_guiState->selectedEntity, newState));
+                    auto meshSpecification = Shape::getMeshSpecification(meshId);
+                    if(meshSpecification) {
+                        newState.setMesh(meshSpecification->vao, meshSpecification->vbo, meshSpecification->ebo, meshId, meshSpecification->modelSpec);
+                        _guiState->selectedEntity.getComponent<CreationTypeComponent>().setType(meshSpecification->creationType);
+                        _guiState->scene->getSceneRegistry()->current->urControl.execute(new ChangeMeshComponentStateCommand(_guiState->selectedEntity, newState));
+                    }
                 }
                 auto textureId = (void*)(typeid(Texture).hash_code());
                 bool isCubemap = false;
@@ -486,9 +488,56 @@ namespace TWE {
                         newState = cameraComponent;
                     }
                 }
+                int renderPathIndex = GUIComponents::combo("Render path", renderPaths[static_cast<int>(cameraComponent.getRenderPath())], renderPaths, 105.f);
+                if(renderPathIndex != -1) {
+                    cameraComponent.setRenderPath(static_cast<RenderPath>(renderPathIndex));
+                    newState = cameraComponent;
+                    _guiState->scene->getSceneRegistry()->current->urControl.execute(new ChangeCameraComponentStateCommand(_guiState->selectedEntity, oldState, newState));
+                }
+                if(!cameraComponent.hasRenderTarget()) {
+                    auto viewport = cameraComponent.getViewport();
+                    if(GUIComponents::dragFloat4("Viewport", viewport, 0.01f, 0.f, 1.f, 105.f)) {
+                        addToURControl = true;
+                        cameraComponent.setViewport(viewport);
+                        newState = cameraComponent;
+                    }
+                }
+                auto renderTargetSpecification = cameraComponent.getRenderTargetSpecification();
+                static std::vector<std::string> renderTargetSizes = { "None", "128", "256", "512", "1024", "2048" };
+                std::string selectedRenderTargetSize = cameraComponent.hasRenderTarget() ? std::to_string(renderTargetSpecification.width) : renderTargetSizes[0];
+                int renderTargetIndex = GUIComponents::combo("Render target", selectedRenderTargetSize, renderTargetSizes, 105.f);
+                if(renderTargetIndex != -1) {
+                    uint32_t renderTargetSize = renderTargetIndex == 0 ? 0 : std::stoi(renderTargetSizes[renderTargetIndex]);
+                    renderTargetSpecification.width = renderTargetSize;
+                    renderTargetSpecification.height = renderTargetSize;
+                    cameraComponent.setRenderTargetSpecification(renderTargetSpecification);
+                    newState = cameraComponent;
+                    _guiState->scene->getSceneRegistry()->current->urControl.execute(new ChangeCameraComponentStateCommand(_guiState->selectedEntity, oldState, newState));
+                }
+                if(cameraComponent.hasRenderTarget()) {
+                    int updateModeIndex = GUIComponents::combo("Update", cameraUpdateModes[static_cast<int>(renderTargetSpecification.updateMode)], cameraUpdateModes, 105.f);
+                    if(updateModeIndex != -1) {
+                        renderTargetSpecification.updateMode = static_cast<CameraUpdateMode>(updateModeIndex);
+                        cameraComponent.setRenderTargetSpecification(renderTargetSpecification);
+                        newState = cameraComponent;
+                        _guiState->scene->getSceneRegistry()->current->urControl.execute(new ChangeCameraComponentStateCommand(_guiState->selectedEntity, oldState, newState));
+                    }
+                    if(renderTargetSpecification.updateMode == CameraUpdateMode::EveryNFrames) {
+                        float updateInterval = static_cast<float>(renderTargetSpecification.updateInterval);
+                        if(GUIComponents::dragFloat("Interval", updateInterval, 1.f, 1.f, 600.f, 105.f)) {
+                            addToURControl = true;
+                            renderTargetSpecification.updateInterval = static_cast<int>(updateInterval);
+                            cameraComponent.setRenderTargetSpecification(renderTargetSpecification);
+                            newState = cameraComponent;
+                        }
+                    } else if(renderTargetSpecification.updateMode == CameraUpdateMode::OnDemand && ImGui::Button("Render"))
+                        cameraComponent.requestRender();
+                    ImGui::Image((void*)(uint64_t)cameraComponent.getRenderTexture(), {100.f, 100.f}, {0, 1}, {1, 0});
+                }
                 if(Input::mouseButtonAction(Mouse::MOUSE_BUTTON_LEFT) == Action::RELEASE && addToURControl) {
                     addToURControl = false;
-                    if(*oldState.getSource() != *newState.getSource())
+                    if(*oldState.getSource() != *newState.getSource() || oldState.getRenderTargetSpecification() != newState.getRenderTargetSpecification()
+                    || oldState.getViewport() != newState.getViewport())
                         _guiState->scene->getSceneRegistry()->current->urControl.execute(new ChangeCameraComponentStateCommand(_guiState->selectedEntity, oldState, newState));
                 }
                 float popUpWidth = 150.f;
@@ -179,6 +179,25 @@ namespace TWE {
         return isInteracted;
     }
 
+    bool GUIComponents::dragFloat4(const std::string& label, glm::vec4& values, float step, float min, float max, float labelColumnWidth) {
+        bool isInteracted = false;
+        ImGui::PushID(label.c_str());
+
+        ImGui::Columns(2);
+        ImGui::SetColumnWidth(0, labelColumnWidth);
+        ImGui::Text(label.c_str());
+
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(ImGui::CalcItemWidth());
+        if(ImGui::DragFloat4("##Values", glm::value_ptr(values), step, min, max, "%.2f"))
+            isInteracted = true;
+        ImGui::PopItemWidth();
+
+        ImGui::Columns(1);
+        ImGui::PopID();
+        return isInteracted;
+    }
+
     bool GUIComponents::dragFloat3(const std::string& label, glm::vec3& values, float step, float resetValue, float min, float max, float labelColumnWidth) {
         bool isInteracted = false;
         ImGuiButtonFlags btnFlags = ImGuiButtonFlags_PressedOnDoubleClick;
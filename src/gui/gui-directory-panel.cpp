@@ -1,6 +1,8 @@
 #include "gui/gui-directory-panel.hpp"
 
 namespace TWE {
+    const int GUIDirectoryPanel::importDelay = 15;
+
     GUIDirectoryPanel::GUIDirectoryPanel() {
         _curPath = "";
         _guiState = nullptr;
@@ -26,6 +28,7 @@ namespace TWE {
             ImGui::End();
             return;
         }
+        updateDirectoryModel();
 
         bool isInteracted = renderContent();
 
@@ -41,6 +44,84 @@ namespace TWE {
     void GUIDirectoryPanel::setRootPath(std::filesystem::path& rootPath) {
         _rootPath = _guiState->projectData->rootPath;
         _curPath = _rootPath;
+        _directoryModel.setRootPath(_rootPath);
+        _pendingImports.clear();
+    }
+
+    void GUIDirectoryPanel::loadScene(std::filesystem::path& scenePath) {
+        _guiState->selectedEntity = {};
+        SceneSerializer::deserialize(_guiState->scene, scenePath.string(), _guiState->projectData);
+        _guiState->projectData->lastScenePath = std::filesystem::relative(scenePath, _guiState->projectData->rootPath);
+        ProjectCreator::save(_guiState->projectData, _guiState->scene->getScriptDLLRegistry());
+        _guiState->undoCount = 0;
+        _guiState->preUndoCount = 0;
+    }
+
+    void GUIDirectoryPanel::updateDirectoryModel() {
+        if(!_guiState->projectData || _directoryModel.getRootPath().empty())
+            return;
+        _thumbnailCache.update();
+        int frame = ImGui::GetFrameCount();
+        for(auto& event : _directoryModel.update()) {
+            _thumbnailCache.invalidate(event.path);
+            if(event.type == FileWatchEventType::Renamed)
+                _thumbnailCache.invalidate(event.oldPath);
+            if(event.type == FileWatchEventType::Created || event.type == FileWatchEventType::Modified || event.type == FileWatchEventType::Renamed)
+                _pendingImports[event.path] = frame;
+        }
+        for(auto importIt = _pendingImports.begin(); importIt != _pendingImports.end();) {
+            if(frame - importIt->second < importDelay) {
+                ++importIt;
+                continue;
+            }
+            reimportAsset(importIt->first);
+            importIt = _pendingImports.erase(importIt);
+        }
+    }
+
+    void GUIDirectoryPanel::reimportAsset(const std::filesystem::path& path) {
+        std::error_code error;
+        if(!std::filesystem::is_regular_file(path, error))
+            return;
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char symbol) { return std::tolower(symbol); });
+        bool isEditable = _guiState->scene->getSceneState() == SceneState::Edit && _guiState->bgFuncsInRun.empty();
+        if(extension == ".png" || extension == ".jpg" || extension == ".jpeg")
+            reimportTextures(path);
+        else if(extension == ".obj" || extension == ".fbx") {
+            if(isEditable && Shape::reloadModel(_guiState->scene, path))
+                std::cout << "Reimported model \"" << path.string() << "\"" << std::endl;
+        } else if(extension == ".scene") {
+            auto scenePath = _guiState->projectData->rootPath / _guiState->projectData->lastScenePath;
+            if(!isEditable || _guiState->undoCount != _guiState->preUndoCount || _guiState->projectData->lastScenePath.empty())
+                return;
+            if(!std::filesystem::equivalent(scenePath, path, error) || !SceneSerializer::isModifiedExternally(path.string()))
+                return;
+            loadScene(scenePath);
+        } else if(extension == ".hpp") {
+            std::string scriptName = path.stem().string();
+            if(!isEditable || !_guiState->scene->getScriptDLLRegistry()->has(scriptName))
+                return;
+            IScene* scene = _guiState->scene;
+            std::shared_future<void> validScriptFuture = std::async(std::launch::async, [scene, scriptName]() {
+                scene->getSceneScripts()->validateScript(scriptName, scene);
+            });
+            _guiState->bgFuncsInRun.push_back(validScriptFuture);
+        }
+    }
+
+    void GUIDirectoryPanel::reimportTextures(const std::filesystem::path& texturePath) {
+        auto absoluteTexturePath = std::filesystem::absolute(texturePath).lexically_normal();
+        _guiState->scene->getSceneRegistry()->edit.entityRegistry.view<MeshComponent>().each([&](entt::entity entity, MeshComponent& meshComponent) {
+            auto texture = meshComponent.getTexture();
+            if(!texture)
+                return;
+            auto textureSpecifications = texture->getAttachments().textureSpecifications;
+            for(auto& textureSpecification : textureSpecifications)
+                if(textureSpecification.texType == TextureType::Texture2D 
+                && std::filesystem::absolute(textureSpecification.imgPath).lexically_normal() == absoluteTexturePath)
+                    texture->setTexture(textureSpecification);
+        });
     }
 
     bool GUIDirectoryPanel::renderContent() {
@@ -76,24 +157,27 @@ namespace TWE {
         int columns = std::max(static_cast<int>(panelWidth / contentCellSize), 1);
 
         ImGui::Columns(columns, 0, false);
-        auto dirIt = std::filesystem::directory_iterator(_curPath);
+        _dirTexture->requestLevel();
+        _fileTexture->requestLevel();
         ImTextureID dirTextureId = (void*)(uint64_t)_dirTexture->getId(0);
         ImTextureID fileTextureId = (void*)(uint64_t)_fileTexture->getId(0);
         static std::filesystem::path fileMenuPath;
         std::string directoryFileMenuPopup = guiPopups[GUIPopupIds::DirectoryFileMenuPopup];
         int i = 0;
-        std::vector<std::filesystem::directory_entry> entries;
-        for(auto& entry : dirIt)
-            entries.push_back(entry);  
-        std::sort(entries.begin(), entries.end(), [](const std::filesystem::directory_entry& entry1, const std::filesystem::directory_entry& entry2) {
-            return entry1.is_directory() && !entry2.is_directory();
-        });
+        auto& entries = _directoryModel.getEntries(_curPath);
         for(auto& entry : entries) {
-            auto& path = entry.path();
+            auto path = _curPath / entry.fileName;
             ImGui::PushID(i++);
 
-            std::string fileName = path.filename().string();
-            ImGui::ImageButton(entry.is_directory() ? dirTextureId : fileTextureId, { contentCellSize - padding, contentCellSize - padding }, {0, 1}, {1, 0});
+            auto& fileName = entry.fileName;
+            ImVec2 buttonSize = { contentCellSize - padding, contentCellSize - padding };
+            ImTextureID textureId = entry.isDirectory ? dirTextureId : fileTextureId;
+            if(!entry.isDirectory && ImGui::IsRectVisible(buttonSize)) {
+                uint32_t thumbnail = _thumbnailCache.getThumbnail(path);
+                if(thumbnail)
+                    textureId = (void*)(uint64_t)thumbnail;
+            }
+            ImGui::ImageButton(textureId, buttonSize, {0, 1}, {1, 0});
             bool canDragAndDrop = _guiState->bgFuncsInRun.empty();
             if(canDragAndDrop && ImGui::BeginDragDropSource()) {
                 const wchar_t* item = path.c_str();
@@ -106,7 +190,7 @@ namespace TWE {
                     ImGui::SetWindowFocus();
                     isInteracted = true;
                     std::string extension = path.extension().string();
-                    if(entry.is_directory())
+                    if(entry.isDirectory)
                         _curPath /= path.filename();
                     else if(extension == ".scene") {
                         if(!_guiState->bgFuncsInRun.empty() || _guiState->undoCount != _guiState->preUndoCount)
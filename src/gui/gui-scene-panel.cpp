@@ -163,6 +163,7 @@ namespace TWE {
         if(_showSceneEntity.getSource() != entt::null) {
             _guiState->selectedEntity.getComponent<ParentChildsComponent>().parent = _showSceneEntity.getSource();
             _showSceneEntity.getComponent<ParentChildsComponent>().childs.push_back(_guiState->selectedEntity.getSource());
+            _guiState->selectedEntity.patchComponent<ParentChildsComponent>();
         }
     }
 
@@ -0,0 +1,298 @@
+#include "gui/gui-thumbnail-cache.hpp"
+
+namespace TWE {
+    const int GUIThumbnailCache::thumbnailSize = 64;
+    const int GUIThumbnailCache::maxLoads = 4;
+    const int GUIThumbnailCache::maxUploadsPerFrame = 4;
+    const uint64_t GUIThumbnailCache::evictionDelay = 600;
+    const std::filesystem::path GUIThumbnailCache::cachePath = "../../cache/thumbnails";
+    const uint32_t GUIThumbnailCache::magic = 0x48545754;
+    const uint32_t GUIThumbnailCache::version = 1;
+
+    GUIThumbnailCache::~GUIThumbnailCache() {
+        clear();
+    }
+
+    void GUIThumbnailCache::update() {
+        ++_frame;
+        _uploads = 0;
+        for(auto thumbnailIt = _thumbnails.begin(); thumbnailIt != _thumbnails.end();) {
+            auto& thumbnail = thumbnailIt->second;
+            if(thumbnail.loadingJob) {
+                if(thumbnail.loadingJob->isDone()) {
+                    thumbnail.pixels = std::move(*thumbnail.loadedPixels);
+                    thumbnail.loadingJob.reset();
+                    thumbnail.loadedPixels.reset();
+                    --_loads;
+                    if(thumbnail.isStale) {
+                        thumbnail.pixels.clear();
+                        thumbnail.isStale = false;
+                    } else
+                        thumbnail.isFailed = thumbnail.pixels.empty();
+                }
+                ++thumbnailIt;
+                continue;
+            }
+            if(thumbnail.lastUsedFrame + evictionDelay < _frame) {
+                release(thumbnail);
+                thumbnailIt = _thumbnails.erase(thumbnailIt);
+            } else
+                ++thumbnailIt;
+        }
+    }
+
+    void GUIThumbnailCache::invalidate(const std::filesystem::path& path) {
+        auto thumbnailIt = _thumbnails.find(path);
+        if(thumbnailIt == _thumbnails.end())
+            return;
+        auto& thumbnail = thumbnailIt->second;
+        if(thumbnail.loadingJob) {
+            thumbnail.isStale = true;
+            return;
+        }
+        release(thumbnail);
+        thumbnail.pixels.clear();
+        thumbnail.isFailed = false;
+    }
+
+    void GUIThumbnailCache::clear() {
+        for(auto& [path, thumbnail] : _thumbnails)
+            release(thumbnail);
+        _thumbnails.clear();
+        _loads = 0;
+    }
+
+    uint32_t GUIThumbnailCache::getThumbnail(const std::filesystem::path& path) {
+        if(!hasThumbnail(path))
+            return 0;
+        auto& thumbnail = _thumbnails[path];
+        thumbnail.lastUsedFrame = _frame;
+        if(thumbnail.texture || thumbnail.isFailed || thumbnail.loadingJob)
+            return thumbnail.texture;
+        if(thumbnail.pixels.empty()) {
+            if(_loads < maxLoads) {
+                ++_loads;
+                auto loadedPixels = std::make_shared<std::vector<uint8_t>>();
+                thumbnail.loadedPixels = loadedPixels;
+                thumbnail.loadingJob = JobSystem::submit([loadedPixels, path]() { *loadedPixels = generate(path); });
+            }
+            return 0;
+        }
+        if(_uploads >= maxUploadsPerFrame)
+            return 0;
+        ++_uploads;
+        glGenTextures(1, &thumbnail.texture);
+        glBindTexture(GL_TEXTURE_2D, thumbnail.texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, thumbnailSize, thumbnailSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        UploadManager::uploadTexture(thumbnail.texture, GL_TEXTURE_2D, 0, thumbnailSize, thumbnailSize, GL_RGBA, GL_UNSIGNED_BYTE, std::move(thumbnail.pixels));
+        thumbnail.pixels = {};
+        return thumbnail.texture;
+    }
+
+    bool GUIThumbnailCache::hasThumbnail(const std::filesystem::path& path) {
+        std::string extension = getExtension(path);
+        return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".obj" || extension == ".fbx";
+    }
+
+    std::vector<uint8_t> GUIThumbnailCache::generate(const std::filesystem::path& path) {
+        uint64_t hash = hashFile(path);
+        if(hash == 0)
+            return {};
+        std::stringstream cacheFileName;
+        cacheFileName << std::hex << std::setw(16) << std::setfill('0') << hash << ".thumb";
+        auto cacheFilePath = cachePath / cacheFileName.str();
+        std::vector<uint8_t> pixels;
+        if(readCache(cacheFilePath, pixels))
+            return pixels;
+        std::string extension = getExtension(path);
+        if(extension == ".obj" || extension == ".fbx")
+            pixels = generateModelThumbnail(path);
+        else
+            pixels = generateImageThumbnail(path);
+        if(!pixels.empty())
+            writeCache(cacheFilePath, pixels);
+        return pixels;
+    }
+
+    std::vector<uint8_t> GUIThumbnailCache::generateImageThumbnail(const std::filesystem::path& path) {
+        int width, height, chanInFile;
+        auto imgBytes = stbi_load(path.string().c_str(), &width, &height, &chanInFile, 4);
+        if(!imgBytes)
+            return {};
+        auto pixels = resize(imgBytes, width, height, thumbnailSize);
+        stbi_image_free(imgBytes);
+        return pixels;
+    }
+
+    std::vector<uint8_t> GUIThumbnailCache::generateModelThumbnail(const std::filesystem::path& path) {
+        ModelLoader modelLoader;
+        if(!modelLoader.prepareModel(path.string()))
+            return {};
+        auto& meshes = modelLoader.getMeshData();
+        glm::vec3 minPosition(FLT_MAX);
+        glm::vec3 maxPosition(-FLT_MAX);
+        for(auto& mesh : meshes)
+            for(int i = 0; i < mesh.vertexCount; ++i) {
+                const float* vertex = mesh.vertices + static_cast<size_t>(i) * VertexLayout::sourceStride;
+                minPosition = glm::min(minPosition, glm::vec3(vertex[0], vertex[1], vertex[2]));
+                maxPosition = glm::max(maxPosition, glm::vec3(vertex[0], vertex[1], vertex[2]));
+            }
+        glm::vec3 center = (minPosition + maxPosition) * 0.5f;
+        float radius = glm::length(maxPosition - minPosition) * 0.5f;
+        if(!(radius > 0.f))
+            return {};
+        const int size = thumbnailSize * 2;
+        glm::mat4 view = glm::lookAt(center + glm::normalize(glm::vec3(1.f, 0.8f, 1.4f)) * radius * 2.f, center, glm::vec3(0.f, 1.f, 0.f));
+        glm::vec3 lightDirection = glm::normalize(glm::vec3(-0.3f, 0.5f, 0.8f));
+        std::vector<float> depth(static_cast<size_t>(size) * size, FLT_MAX);
+        std::vector<uint8_t> frame(static_cast<size_t>(size) * size * 4, 0);
+        for(auto& mesh : meshes) {
+            for(int i = 0; i + 2 < mesh.indexCount; i += 3) {
+                glm::vec3 points[3];
+                for(int j = 0; j < 3; ++j) {
+                    uint32_t index = mesh.indexType == GL_UNSIGNED_SHORT ? static_cast<uint16_t*>(mesh.indices)[i + j] : static_cast<uint32_t*>(mesh.indices)[i + j];
+                    if(index >= static_cast<uint32_t>(mesh.vertexCount))
+                        index = 0;
+                    const float* vertex = mesh.vertices + static_cast<size_t>(index) * VertexLayout::sourceStride;
+                    points[j] = glm::vec3(view * glm::vec4(vertex[0], vertex[1], vertex[2], 1.f));
+                }
+                glm::vec3 normal = glm::cross(points[1] - points[0], points[2] - points[0]);
+                if(glm::length(normal) <= 0.f)
+                    continue;
+                float shade = 0.25f + 0.75f * std::abs(glm::dot(glm::normalize(normal), lightDirection));
+                uint8_t color[4] = {
+                    static_cast<uint8_t>(190.f * shade), static_cast<uint8_t>(200.f * shade), static_cast<uint8_t>(215.f * shade), 255
+                };
+                glm::vec3 screen[3];
+                for(int j = 0; j < 3; ++j)
+                    screen[j] = glm::vec3((points[j].x / radius * 0.5f + 0.5f) * size, (points[j].y / radius * 0.5f + 0.5f) * size, -points[j].z);
+                float area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y) - (screen[2].x - screen[0].x) * (screen[1].y - screen[0].y);
+                if(area == 0.f)
+                    continue;
+                int minX = std::max(static_cast<int>(std::floor(std::min({ screen[0].x, screen[1].x, screen[2].x }))), 0);
+                int maxX = std::min(static_cast<int>(std::ceil(std::max({ screen[0].x, screen[1].x, screen[2].x }))), size - 1);
+                int minY = std::max(static_cast<int>(std::floor(std::min({ screen[0].y, screen[1].y, screen[2].y }))), 0);
+                int maxY = std::min(static_cast<int>(std::ceil(std::max({ screen[0].y, screen[1].y, screen[2].y }))), size - 1);
+                for(int y = minY; y <= maxY; ++y)
+                    for(int x = minX; x <= maxX; ++x) {
+                        glm::vec2 pixel(x + 0.5f, y + 0.5f);
+                        float weights[3];
+                        for(int j = 0; j < 3; ++j) {
+                            auto& from = screen[(j + 1) % 3];
+                            auto& to = screen[(j + 2) % 3];
+                            weights[j] = ((to.x - from.x) * (pixel.y - from.y) - (pixel.x - from.x) * (to.y - from.y)) / area;
+                        }
+                        if(weights[0] < 0.f || weights[1] < 0.f || weights[2] < 0.f)
+                            continue;
+                        float z = weights[0] * screen[0].z + weights[1] * screen[1].z + weights[2] * screen[2].z;
+                        size_t pixelIndex = static_cast<size_t>(y) * size + x;
+                        if(z >= depth[pixelIndex])
+                            continue;
+                        depth[pixelIndex] = z;
+                        std::memcpy(frame.data() + pixelIndex * 4, color, 4);
+                    }
+            }
+        }
+        std::vector<uint8_t> pixels(static_cast<size_t>(thumbnailSize) * thumbnailSize * 4);
+        for(int y = 0; y < thumbnailSize; ++y)
+            for(int x = 0; x < thumbnailSize; ++x)
+                for(int channel = 0; channel < 4; ++channel) {
+                    int sum = 0;
+                    for(int sampleY = 0; sampleY < 2; ++sampleY)
+                        for(int sampleX = 0; sampleX < 2; ++sampleX)
+                            sum += frame[(static_cast<size_t>(y * 2 + sampleY) * size + x * 2 + sampleX) * 4 + channel];
+                    pixels[(static_cast<size_t>(y) * thumbnailSize + x) * 4 + channel] = static_cast<uint8_t>((sum + 2) / 4);
+                }
+        return pixels;
+    }
+
+    std::vector<uint8_t> GUIThumbnailCache::resize(const uint8_t* pixels, int width, int height, int size) {
+        std::vector<uint8_t> result(static_cast<size_t>(size) * size * 4, 0);
+        float scale = static_cast<float>(size) / std::max(width, height);
+        int resultWidth = std::clamp(static_cast<int>(width * scale + 0.5f), 1, size);
+        int resultHeight = std::clamp(static_cast<int>(height * scale + 0.5f), 1, size);
+        int offsetX = (size - resultWidth) / 2;
+        int offsetY = (size - resultHeight) / 2;
+        for(int y = 0; y < resultHeight; ++y) {
+            int sourceY0 = y * height / resultHeight;
+            int sourceY1 = std::max((y + 1) * height / resultHeight, sourceY0 + 1);
+            for(int x = 0; x < resultWidth; ++x) {
+                int sourceX0 = x * width / resultWidth;
+                int sourceX1 = std::max((x + 1) * width / resultWidth, sourceX0 + 1);
+                uint32_t sum[4] = { 0, 0, 0, 0 };
+                for(int sourceY = sourceY0; sourceY < sourceY1; ++sourceY)
+                    for(int sourceX = sourceX0; sourceX < sourceX1; ++sourceX)
+                        for(int channel = 0; channel < 4; ++channel)
+                            sum[channel] += pixels[(static_cast<size_t>(sourceY) * width + sourceX) * 4 + channel];
+                uint32_t count = static_cast<uint32_t>((sourceY1 - sourceY0) * (sourceX1 - sourceX0));
+                uint8_t* dest = result.data() + (static_cast<size_t>(size - 1 - offsetY - y) * size + offsetX + x) * 4;
+                for(int channel = 0; channel < 4; ++channel)
+                    dest[channel] = static_cast<uint8_t>((sum[channel] + count / 2) / count);
+            }
+        }
+        return result;
+    }
+
+    bool GUIThumbnailCache::readCache(const std::filesystem::path& cacheFilePath, std::vector<uint8_t>& pixels) {
+        std::ifstream is(cacheFilePath, std::ios::binary);
+        if(!is.is_open())
+            return false;
+        GUIThumbnailHeaderSpecification header;
+        if(!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return false;
+        if(header.magic != magic || header.version != version || header.size != static_cast<uint32_t>(thumbnailSize))
+            return false;
+        pixels.resize(static_cast<size_t>(thumbnailSize) * thumbnailSize * 4);
+        if(!is.read(reinterpret_cast<char*>(pixels.data()), pixels.size())) {
+            pixels.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void GUIThumbnailCache::writeCache(const std::filesystem::path& cacheFilePath, const std::vector<uint8_t>& pixels) {
+        std::error_code error;
+        std::filesystem::create_directories(cacheFilePath.parent_path(), error);
+        std::ofstream os(cacheFilePath, std::ios::binary | std::ios::trunc);
+        if(!os.is_open())
+            return;
+        GUIThumbnailHeaderSpecification header;
+        header.magic = magic;
+        header.version = version;
+        header.size = static_cast<uint32_t>(thumbnailSize);
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+    }
+
+    uint64_t GUIThumbnailCache::hashFile(const std::filesystem::path& path) {
+        MappedFile file(path);
+        if(!file.isOpen())
+            return 0;
+        uint64_t hash = 14695981039346656037ull;
+        const uint8_t* data = file.getData();
+        for(size_t i = 0; i < file.getSize(); ++i) {
+            hash ^= data[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    std::string GUIThumbnailCache::getExtension(const std::filesystem::path& path) {
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char symbol) { return std::tolower(symbol); });
+        return extension;
+    }
+
+    void GUIThumbnailCache::release(GUIThumbnailSpecification& thumbnail) {
+        if(thumbnail.texture) {
+            UploadManager::cancel(UploadTargetType::Texture, thumbnail.texture);
+            glDeleteTextures(1, &thumbnail.texture);
+        }
+        thumbnail.texture = 0;
+    }
+}
\ No newline at end of file
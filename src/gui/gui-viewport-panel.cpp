@@ -21,11 +21,15 @@ namespace TWE {
             ImGui::SetWindowFocus();
         _guiState->isFocusedOnViewport = ImGui::IsWindowFocused();
         ImVec2 viewPortSize = ImGui::GetContentRegionAvail();
-        auto& frameSize = _guiState->window->getFrameBuffer()->getSize();
-        if(viewPortSize.x != frameSize.width || viewPortSize.y != frameSize.height)
-            _guiState->window->getFrameBuffer()->resize(viewPortSize.x, viewPortSize.y);
-        auto frameId = (void*)(uint64_t)_guiState->window->getFrameBuffer()->getColorAttachment(0);
-        ImGui::Image(frameId, viewPortSize, {0, 1}, {1, 0});
+        auto frameBuffer = _guiState->window->getFrameBuffer();
+        auto& frameSize = frameBuffer->getSize();
+        auto renderSize = DynamicResolution::getScaledSize(viewPortSize.x, viewPortSize.y);
+        if(renderSize.width != frameSize.width || renderSize.height != frameSize.height)
+            frameBuffer->resize(renderSize.width, renderSize.height);
+        auto& frameCapacity = frameBuffer->getCapacity();
+        ImVec2 frameUV = { static_cast<float>(frameSize.width) / frameCapacity.width, static_cast<float>(frameSize.height) / frameCapacity.height };
+        auto frameId = (void*)(uint64_t)frameBuffer->getColorAttachment(0);
+        ImGui::Image(frameId, viewPortSize, {0, frameUV.y}, {frameUV.x, 0});
 
         auto& windowSize = ImGui::GetWindowSize();
         auto& minBound = ImGui::GetWindowPos();
@@ -43,7 +47,7 @@ namespace TWE {
             if(mousePos.x >= 0.f && mousePos.y >= 0.f && mousePos.x < viewPortSize.x && mousePos.y < viewPortSize.y) {
                 _guiState->isMouseOnViewport = true;
                 if(!isUsing && !getIsMouseDisabled() && ImGui::IsMouseClicked(0)) {
-                    int data = _guiState->window->getFrameBuffer()->readPixel(1, (int)mousePos.x, (int)mousePos.y);
+                    int data = frameBuffer->readPixel(1, (int)(mousePos.x * frameSize.width / viewPortSize.x), (int)(mousePos.y * frameSize.height / viewPortSize.y));
                     if(data == -1 || !_guiState->scene->getSceneStateSpecification()->entityRegistry.valid((entt::entity)data))
                         unselectEntity(_guiState->selectedEntity);
                     else
@@ -155,6 +159,15 @@ namespace TWE {
             ImGui::PopItemFlag();
             ImGui::PopStyleVar();
         }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(100.f);
+        int renderPathIndex = static_cast<int>(_guiState->scene->getRenderPath());
+        if(ImGui::BeginCombo("##RenderPath", renderPaths[renderPathIndex].c_str())) {
+            for(int i = static_cast<int>(RenderPath::Forward); i <= static_cast<int>(RenderPath::Deferred); ++i)
+                if(ImGui::Selectable(renderPaths[i].c_str(), i == renderPathIndex))
+                    _guiState->scene->setRenderPath(static_cast<RenderPath>(i));
+            ImGui::EndCombo();
+        }
         ImGui::End();
     }
 
@@ -0,0 +1,201 @@
+#include "jobs/job-system.hpp"
+
+namespace TWE {
+    std::vector<std::thread>* JobSystem::workers = new std::vector<std::thread>();
+    std::vector<std::unique_ptr<JobQueueSpecification>>* JobSystem::queues = new std::vector<std::unique_ptr<JobQueueSpecification>>();
+    JobQueueSpecification* JobSystem::mainThreadQueue = new JobQueueSpecification();
+    std::mutex JobSystem::sleepMutex;
+    std::condition_variable JobSystem::sleepCondition;
+    std::atomic<int> JobSystem::queuedJobs = 0;
+    std::atomic<uint32_t> JobSystem::nextQueue = 0;
+    std::atomic<bool> JobSystem::isRunning = false;
+    std::atomic<std::thread::id> JobSystem::mainThreadId = std::this_thread::get_id();
+    thread_local int JobSystem::threadIndex = -1;
+
+    Job::Job(const std::function<void()>& task, JobAffinity affinity)
+        : _task(task), _affinity(affinity), _pendingDependencies(1), _isDone(false) {}
+
+    void JobSystem::init(uint32_t workerCount) {
+        if(isRunning)
+            return;
+        if(workerCount == 0)
+            workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+        mainThreadId = std::this_thread::get_id();
+        threadIndex = 0;
+        queues->clear();
+        for(uint32_t i = 0; i <= workerCount; ++i)
+            queues->push_back(std::make_unique<JobQueueSpecification>());
+        isRunning = true;
+        for(uint32_t i = 1; i <= workerCount; ++i)
+            workers->emplace_back(&JobSystem::workerLoop, i);
+    }
+
+    void JobSystem::shutdown() {
+        if(!isRunning)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            isRunning = false;
+        }
+        sleepCondition.notify_all();
+        for(auto& worker : *workers)
+            worker.join();
+        workers->clear();
+        while(executeNext() || executeMainThreadJob());
+        queues->clear();
+        queuedJobs = 0;
+    }
+
+    JobHandle JobSystem::submit(const std::function<void()>& task, const std::vector<JobHandle>& dependencies, JobAffinity affinity) {
+        auto job = std::make_shared<Job>(task, affinity);
+        for(auto& dependency : dependencies) {
+            if(!dependency)
+                continue;
+            std::lock_guard<std::mutex> lock(dependency->_continuationsMutex);
+            if(dependency->_isDone)
+                continue;
+            dependency->_continuations.push_back(job);
+            ++job->_pendingDependencies;
+        }
+        if(--job->_pendingDependencies == 0)
+            schedule(job);
+        return job;
+    }
+
+    void JobSystem::wait(const JobHandle& job) {
+        if(!job)
+            return;
+        while(!job->isDone()) {
+            if(isMainThread() && executeMainThreadJob())
+                continue;
+            if(!executeNext())
+                std::this_thread::yield();
+        }
+    }
+
+    void JobSystem::wait(const std::vector<JobHandle>& jobs) {
+        for(auto& job : jobs)
+            wait(job);
+    }
+
+    void JobSystem::executeMainThreadJobs() {
+        if(!isMainThread())
+            return;
+        while(executeMainThreadJob());
+    }
+
+    void JobSystem::runOnMainThread(const std::function<void()>& task) {
+        if(isMainThread() || !isRunning) {
+            task();
+            return;
+        }
+        wait(submit(task, {}, JobAffinity::MainThread));
+    }
+
+    void JobSystem::setMainThread() {
+        mainThreadId = std::this_thread::get_id();
+    }
+
+    void JobSystem::workerLoop(uint32_t index) {
+        threadIndex = static_cast<int>(index);
+        while(isRunning) {
+            if(executeNext())
+                continue;
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepCondition.wait(lock, []() { return queuedJobs > 0 || !isRunning; });
+        }
+    }
+
+    void JobSystem::schedule(const JobHandle& job) {
+        if(job->_affinity == JobAffinity::MainThread) {
+            std::lock_guard<std::mutex> lock(mainThreadQueue->mutex);
+            mainThreadQueue->jobs.push_back(job);
+            return;
+        }
+        if(queues->empty()) {
+            execute(job);
+            return;
+        }
+        uint32_t index = threadIndex >= 0 ? threadIndex : nextQueue++ % queues->size();
+        {
+            auto& queue = *(*queues)[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(job);
+        }
+        ++queuedJobs;
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+        }
+        sleepCondition.notify_one();
+    }
+
+    void JobSystem::execute(const JobHandle& job) {
+        job->_task();
+        std::vector<JobHandle> continuations;
+        {
+            std::lock_guard<std::mutex> lock(job->_continuationsMutex);
+            job->_isDone = true;
+            continuations.swap(job->_continuations);
+        }
+        for(auto& continuation : continuations)
+            if(--continuation->_pendingDependencies == 0)
+                schedule(continuation);
+    }
+
+    bool JobSystem::executeNext() {
+        if(queues->empty())
+            return false;
+        JobHandle job = threadIndex >= 0 ? pop(threadIndex) : nullptr;
+        if(!job)
+            job = steal(threadIndex >= 0 ? threadIndex : 0);
+        if(!job)
+            return false;
+        execute(job);
+        return true;
+    }
+
+    bool JobSystem::executeMainThreadJob() {
+        JobHandle job;
+        {
+            std::lock_guard<std::mutex> lock(mainThreadQueue->mutex);
+            if(mainThreadQueue->jobs.empty())
+                return false;
+            job = mainThreadQueue->jobs.front();
+            mainThreadQueue->jobs.pop_front();
+        }
+        execute(job);
+        return true;
+    }
+
+    JobHandle JobSystem::pop(uint32_t index) {
+        auto& queue = *(*queues)[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(queue.jobs.empty())
+            return nullptr;
+        JobHandle job = queue.jobs.back();
+        queue.jobs.pop_back();
+        --queuedJobs;
+        return job;
+    }
+
+    JobHandle JobSystem::steal(uint32_t thief) {
+        uint32_t queueCount = static_cast<uint32_t>(queues->size());
+        for(uint32_t offset = 1; offset <= queueCount; ++offset) {
+            auto& queue = *(*queues)[(thief + offset) % queueCount];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(queue.jobs.empty())
+                continue;
+            JobHandle job = queue.jobs.front();
+            queue.jobs.pop_front();
+            --queuedJobs;
+            return job;
+        }
+        return nullptr;
+    }
+
+    bool Job::isDone() const noexcept { return _isDone; }
+    JobAffinity Job::getAffinity() const noexcept { return _affinity; }
+    uint32_t JobSystem::getWorkerCount() noexcept { return static_cast<uint32_t>(workers->size()); }
+    bool JobSystem::isMainThread() noexcept { return std::this_thread::get_id() == mainThreadId; }
+    int JobSystem::getThreadIndex() noexcept { return threadIndex; }
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "model-loader/mesh-cache.hpp"
+
+namespace TWE {
+    const std::string MeshCache::extension = ".twemesh";
+    const uint32_t MeshCache::magic = 0x4D455754;
+    const uint32_t MeshCache::version = 3;
+    std::atomic<uint32_t> MeshCache::writeCounter = 0;
+
+    std::filesystem::path MeshCache::getCachePath(const std::filesystem::path& sourcePath) {
+        std::error_code error;
+        auto absolutePath = std::filesystem::absolute(sourcePath, error).lexically_normal();
+        return CacheDirectory::getFilePath("meshes", (error ? sourcePath : absolutePath).string(), extension);
+    }
+
+    uint64_t MeshCache::calculateHash(const std::filesystem::path& sourcePath, const MeshOptimizationSpecification& optimizationSpec) {
+        MappedFile sourceFile(sourcePath);
+        if(!sourceFile.isOpen())
+            return 0;
+        uint64_t hash = hashBytes(sourceFile.getData(), sourceFile.getSize(), 14695981039346656037ull);
+        uint32_t flags = optimizationSpec.weldVertices | optimizationSpec.optimizeVertexCache << 1 
+            | optimizationSpec.optimizeOverdraw << 2 | optimizationSpec.optimizeVertexFetch << 3;
+        hash = hashBytes(&flags, sizeof(flags), hash);
+        hash = hashBytes(&optimizationSpec.overdrawThreshold, sizeof(optimizationSpec.overdrawThreshold), hash);
+        hash = hashBytes(&optimizationSpec.cacheSize, sizeof(optimizationSpec.cacheSize), hash);
+        return hash;
+    }
+
+    bool MeshCache::read(const std::filesystem::path& cachePath, uint64_t sourceHash, MappedFile& cacheFile, std::vector<ModelMeshDataSpecification>& meshes) {
+        if(!std::filesystem::exists(cachePath))
+            return false;
+        if(!cacheFile.open(cachePath) || cacheFile.getSize() < sizeof(MeshCacheHeaderSpecification)) {
+            cacheFile.close();
+            return false;
+        }
+        const uint8_t* data = cacheFile.getData();
+        size_t size = cacheFile.getSize();
+        MeshCacheHeaderSpecification header;
+        std::memcpy(&header, data, sizeof(header));
+        uint64_t tableEnd = sizeof(header) + static_cast<uint64_t>(header.meshCount) * sizeof(MeshCacheEntrySpecification)
+            + static_cast<uint64_t>(header.lodCount) * sizeof(MeshCacheLODEntrySpecification);
+        if(header.magic != magic || header.version != version || header.sourceHash != sourceHash || tableEnd > size) {
+            cacheFile.close();
+            return false;
+        }
+        std::vector<MeshCacheEntrySpecification> entries(header.meshCount);
+        std::vector<MeshCacheLODEntrySpecification> lodEntries(header.lodCount);
+        std::memcpy(entries.data(), data + sizeof(header), entries.size() * sizeof(MeshCacheEntrySpecification));
+        std::memcpy(lodEntries.data(), data + sizeof(header) + entries.size() * sizeof(MeshCacheEntrySpecification), 
+            lodEntries.size() * sizeof(MeshCacheLODEntrySpecification));
+        auto isRangeValid = [&](uint64_t offset, uint64_t rangeSize, uint64_t alignment) {
+            return alignment != 0 && offset % alignment == 0 && offset + rangeSize <= size;
+        };
+        uint64_t lodCount = 0;
+        for(auto& entry : entries) {
+            size_t indexSize = getIndexSize(entry.indexType);
+            if(!isRangeValid(entry.vertexOffset, static_cast<uint64_t>(entry.vertexCount) * VertexLayout::sourceStride * sizeof(float), sizeof(float))
+                || !isRangeValid(entry.indexOffset, static_cast<uint64_t>(entry.indexCount) * indexSize, indexSize)
+                || !isIndexRangeValid(data + entry.indexOffset, entry.indexCount, entry.indexType, entry.vertexCount)
+                || lodCount + entry.lodCount > lodEntries.size()) {
+                cacheFile.close();
+                return false;
+            }
+            for(uint32_t i = 0; i < entry.lodCount; ++i) {
+                auto& lodEntry = lodEntries[lodCount + i];
+                if(!isRangeValid(lodEntry.indexOffset, static_cast<uint64_t>(lodEntry.indexCount) * indexSize, indexSize)
+                    || !isIndexRangeValid(data + lodEntry.indexOffset, lodEntry.indexCount, entry.indexType, entry.vertexCount)) {
+                    cacheFile.close();
+                    return false;
+                }
+            }
+            lodCount += entry.lodCount;
+        }
+        uint8_t* mappedData = const_cast<uint8_t*>(data);
+        meshes.clear();
+        meshes.reserve(entries.size());
+        lodCount = 0;
+        for(auto& entry : entries) {
+            ModelMeshDataSpecification mesh;
+            mesh.vertices = reinterpret_cast<float*>(mappedData + entry.vertexOffset);
+            mesh.vertexCount = entry.vertexCount;
+            mesh.indices = mappedData + entry.indexOffset;
+            mesh.indexCount = entry.indexCount;
+            mesh.indexType = entry.indexType;
+            mesh.bounds = { { entry.center[0], entry.center[1], entry.center[2] }, entry.radius };
+            mesh.ownsData = false;
+            for(uint32_t i = 0; i < entry.lodCount; ++i) {
+                auto& lodEntry = lodEntries[lodCount++];
+                MeshLODDataSpecification lod;
+                lod.indices = mappedData + lodEntry.indexOffset;
+                lod.indexCount = lodEntry.indexCount;
+                lod.indexType = entry.indexType;
+                lod.error = lodEntry.error;
+                lod.ownsIndices = false;
+                mesh.lods.push_back(lod);
+            }
+            meshes.push_back(mesh);
+        }
+        return true;
+    }
+
+    bool MeshCache::write(const std::filesystem::path& cachePath, uint64_t sourceHash, const std::vector<ModelMeshDataSpecification>& meshes) {
+        MeshCacheHeaderSpecification header;
+        header.magic = magic;
+        header.version = version;
+        header.sourceHash = sourceHash;
+        header.meshCount = static_cast<uint32_t>(meshes.size());
+        for(auto& mesh : meshes)
+            header.lodCount += static_cast<uint32_t>(mesh.lods.size());
+        std::vector<MeshCacheEntrySpecification> entries(meshes.size());
+        std::vector<MeshCacheLODEntrySpecification> lodEntries(header.lodCount);
+        uint64_t offset = align(sizeof(header) + entries.size() * sizeof(MeshCacheEntrySpecification) 
+            + lodEntries.size() * sizeof(MeshCacheLODEntrySpecification));
+        for(size_t i = 0; i < meshes.size(); ++i) {
+            auto& mesh = meshes[i];
+            auto& entry = entries[i];
+            entry.vertexCount = mesh.vertexCount;
+            entry.indexCount = mesh.indexCount;
+            entry.indexType = mesh.indexType;
+            entry.lodCount = static_cast<uint32_t>(mesh.lods.size());
+            entry.center[0] = mesh.bounds.center.x;
+            entry.center[1] = mesh.bounds.center.y;
+            entry.center[2] = mesh.bounds.center.z;
+            entry.radius = mesh.bounds.radius;
+            entry.vertexOffset = offset;
+            offset += static_cast<uint64_t>(mesh.vertexCount) * VertexLayout::sourceStride * sizeof(float);
+        }
+        for(size_t i = 0; i < meshes.size(); ++i) {
+            auto& entry = entries[i];
+            entry.indexOffset = align(offset, getIndexSize(entry.indexType));
+            offset = entry.indexOffset + static_cast<uint64_t>(entry.indexCount) * getIndexSize(entry.indexType);
+        }
+        size_t lodCount = 0;
+        for(auto& mesh : meshes)
+            for(auto& lod : mesh.lods) {
+                auto& lodEntry = lodEntries[lodCount++];
+                lodEntry.indexCount = lod.indexCount;
+                lodEntry.error = lod.error;
+                lodEntry.indexOffset = align(offset);
+                offset = lodEntry.indexOffset + static_cast<uint64_t>(lod.indexCount) * getIndexSize(mesh.indexType);
+            }
+        std::filesystem::path tempPath = cachePath;
+        tempPath += "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "-" + std::to_string(writeCounter++) + ".tmp";
+        std::ofstream os(tempPath, std::ios::binary | std::ios::trunc);
+        if(!os.is_open()) {
+            std::cout << "Mesh cache < " << cachePath.string() << " > could not be written." << std::endl;
+            return false;
+        }
+        static const char padding[8] = {};
+        auto writeAt = [&](uint64_t dataOffset, const void* bytes, size_t byteCount) {
+            uint64_t position = static_cast<uint64_t>(os.tellp());
+            os.write(padding, dataOffset - position);
+            os.write(static_cast<const char*>(bytes), byteCount);
+        };
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(MeshCacheEntrySpecification));
+        os.write(reinterpret_cast<const char*>(lodEntries.data()), lodEntries.size() * sizeof(MeshCacheLODEntrySpecification));
+        for(size_t i = 0; i < meshes.size(); ++i)
+            writeAt(entries[i].vertexOffset, meshes[i].vertices, static_cast<size_t>(meshes[i].vertexCount) * VertexLayout::sourceStride * sizeof(float));
+        for(size_t i = 0; i < meshes.size(); ++i)
+            writeAt(entries[i].indexOffset, meshes[i].indices, static_cast<size_t>(meshes[i].indexCount) * getIndexSize(meshes[i].indexType));
+        lodCount = 0;
+        for(auto& mesh : meshes)
+            for(auto& lod : mesh.lods)
+                writeAt(lodEntries[lodCount++].indexOffset, lod.indices, static_cast<size_t>(lod.indexCount) * getIndexSize(mesh.indexType));
+        os.close();
+        if(os.fail()) {
+            std::filesystem::remove(tempPath);
+            return false;
+        }
+        std::error_code error;
+        std::filesystem::rename(tempPath, cachePath, error);
+        if(error) {
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+        return true;
+    }
+
+    uint64_t MeshCache::hashBytes(const void* data, size_t size, uint64_t hash) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        size_t wordCount = size / sizeof(uint64_t);
+        for(size_t i = 0; i < wordCount; ++i) {
+            uint64_t word;
+            std::memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(word));
+            hash = (hash ^ word) * 1099511628211ull;
+        }
+        for(size_t i = wordCount * sizeof(uint64_t); i < size; ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        return hash;
+    }
+
+    size_t MeshCache::getIndexSize(uint32_t indexType) noexcept {
+        switch (indexType) {
+        case GL_UNSIGNED_SHORT: return sizeof(uint16_t);
+        case GL_UNSIGNED_INT: return sizeof(uint32_t);
+        default: return 0;
+        }
+    }
+
+    bool MeshCache::isIndexRangeValid(const uint8_t* indices, uint32_t indexCount, uint32_t indexType, uint32_t vertexCount) noexcept {
+        for(uint32_t i = 0; i < indexCount; ++i) {
+            uint32_t index;
+            if(indexType == GL_UNSIGNED_SHORT) {
+                uint16_t shortIndex;
+                std::memcpy(&shortIndex, indices + i * sizeof(uint16_t), sizeof(shortIndex));
+                index = shortIndex;
+            } else
+                std::memcpy(&index, indices + i * sizeof(uint32_t), sizeof(index));
+            if(index >= vertexCount)
+                return false;
+        }
+        return true;
+    }
+
+    uint64_t MeshCache::align(uint64_t offset, uint64_t alignment) noexcept {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include "model-loader/mesh-optimizer.hpp"
+
+namespace TWE {
+    const int MeshOptimizer::vertexStride = 8;
+
+    MeshOptimizationStatistics MeshOptimizer::optimize(float* vertices, int& vertexCount, uint32_t* indices, int indexCount,
+        const MeshOptimizationSpecification& optimizationSpec) {
+        MeshOptimizationStatistics statistics;
+        statistics.sourceVertexCount = vertexCount;
+        statistics.triangleCount = indexCount / 3;
+        statistics.sourceACMR = calculateACMR(indices, indexCount, vertexCount, optimizationSpec.cacheSize);
+        if(optimizationSpec.weldVertices)
+            vertexCount = weldVertices(vertices, vertexCount, indices, indexCount);
+        if(optimizationSpec.optimizeVertexCache)
+            optimizeVertexCache(indices, indexCount, vertexCount, optimizationSpec.cacheSize);
+        if(optimizationSpec.optimizeOverdraw)
+            optimizeOverdraw(indices, indexCount, vertices, vertexCount, optimizationSpec.overdrawThreshold, optimizationSpec.cacheSize);
+        if(optimizationSpec.optimizeVertexFetch)
+            vertexCount = optimizeVertexFetch(vertices, vertexCount, indices, indexCount);
+        statistics.vertexCount = vertexCount;
+        statistics.ACMR = calculateACMR(indices, indexCount, vertexCount, optimizationSpec.cacheSize);
+        statistics.ATVR = vertexCount > 0 ? statistics.ACMR * statistics.triangleCount / vertexCount : 0.f;
+        return statistics;
+    }
+
+    int MeshOptimizer::weldVertices(float* vertices, int vertexCount, uint32_t* indices, int indexCount) {
+        size_t tableSize = 1;
+        while(tableSize < static_cast<size_t>(vertexCount) * 2)
+            tableSize <<= 1;
+        std::vector<uint32_t> table(tableSize, UINT32_MAX);
+        std::vector<uint32_t> remap(vertexCount);
+        int uniqueCount = 0;
+        for(int i = 0; i < vertexCount; ++i) {
+            const float* vertex = vertices + static_cast<size_t>(i) * vertexStride;
+            size_t slot = hashVertex(vertex) & (tableSize - 1);
+            while(true) {
+                uint32_t entry = table[slot];
+                if(entry == UINT32_MAX) {
+                    if(uniqueCount != i)
+                        std::memcpy(vertices + static_cast<size_t>(uniqueCount) * vertexStride, vertex, vertexStride * sizeof(float));
+                    table[slot] = uniqueCount;
+                    remap[i] = uniqueCount++;
+                    break;
+                }
+                if(std::memcmp(vertices + static_cast<size_t>(entry) * vertexStride, vertex, vertexStride * sizeof(float)) == 0) {
+                    remap[i] = entry;
+                    break;
+                }
+                slot = (slot + 1) & (tableSize - 1);
+            }
+        }
+        for(int i = 0; i < indexCount; ++i)
+            indices[i] = remap[indices[i]];
+        return uniqueCount;
+    }
+
+    void MeshOptimizer::optimizeVertexCache(uint32_t* indices, int indexCount, int vertexCount, int cacheSize) {
+        int triangleCount = indexCount / 3;
+        if(triangleCount == 0 || vertexCount == 0)
+            return;
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for(int i = 0; i < indexCount; ++i)
+            ++offsets[indices[i] + 1];
+        for(int i = 0; i < vertexCount; ++i)
+            offsets[i + 1] += offsets[i];
+        std::vector<uint32_t> adjacency(indexCount);
+        std::vector<uint32_t> fillOffsets(offsets.begin(), offsets.end() - 1);
+        for(int i = 0; i < indexCount; ++i)
+            adjacency[fillOffsets[indices[i]]++] = i / 3;
+        std::vector<int> liveTriangles(vertexCount);
+        for(int i = 0; i < vertexCount; ++i)
+            liveTriangles[i] = offsets[i + 1] - offsets[i];
+        std::vector<int> timestamps(vertexCount, 0);
+        std::vector<bool> emitted(triangleCount, false);
+        std::vector<uint32_t> deadEnd;
+        deadEnd.reserve(indexCount);
+        std::vector<uint32_t> candidates;
+        candidates.reserve(indexCount);
+        std::vector<uint32_t> result(indexCount);
+        int resultIndex = 0;
+        int time = cacheSize + 1;
+        int cursor = 0;
+        int fanningVertex = 0;
+        while(fanningVertex >= 0) {
+            candidates.clear();
+            for(uint32_t i = offsets[fanningVertex]; i < offsets[fanningVertex + 1]; ++i) {
+                uint32_t triangle = adjacency[i];
+                if(emitted[triangle])
+                    continue;
+                for(int j = 0; j < 3; ++j) {
+                    uint32_t vertex = indices[triangle * 3 + j];
+                    result[resultIndex++] = vertex;
+                    deadEnd.push_back(vertex);
+                    candidates.push_back(vertex);
+                    --liveTriangles[vertex];
+                    if(time - timestamps[vertex] > cacheSize)
+                        timestamps[vertex] = time++;
+                }
+                emitted[triangle] = true;
+            }
+            fanningVertex = -1;
+            int bestPriority = -1;
+            for(auto vertex : candidates) {
+                if(liveTriangles[vertex] <= 0)
+                    continue;
+                int priority = 0;
+                if(time - timestamps[vertex] + 2 * liveTriangles[vertex] <= cacheSize)
+                    priority = time - timestamps[vertex];
+                if(priority > bestPriority) {
+                    bestPriority = priority;
+                    fanningVertex = vertex;
+                }
+            }
+            while(fanningVertex < 0 && !deadEnd.empty()) {
+                uint32_t vertex = deadEnd.back();
+                deadEnd.pop_back();
+                if(liveTriangles[vertex] > 0)
+                    fanningVertex = vertex;
+            }
+            for(; fanningVertex < 0 && cursor < vertexCount; ++cursor)
+                if(liveTriangles[cursor] > 0)
+                    fanningVertex = cursor;
+        }
+        std::memcpy(indices, result.data(), resultIndex * sizeof(uint32_t));
+    }
+
+    void MeshOptimizer::optimizeOverdraw(uint32_t* indices, int indexCount, const float* vertices, int vertexCount, float threshold, int cacheSize) {
+        int triangleCount = indexCount / 3;
+        if(triangleCount < 2)
+            return;
+        std::vector<int> clusters;
+        std::vector<int> timestamps(vertexCount, 0);
+        int time = cacheSize + 1;
+        for(int i = 0; i < triangleCount; ++i) {
+            int misses = 0;
+            for(int j = 0; j < 3; ++j) {
+                uint32_t vertex = indices[i * 3 + j];
+                if(time - timestamps[vertex] > cacheSize) {
+                    timestamps[vertex] = time++;
+                    ++misses;
+                }
+            }
+            if(i == 0 || misses == 3)
+                clusters.push_back(i);
+        }
+        int clusterCount = static_cast<int>(clusters.size());
+        if(clusterCount < 2)
+            return;
+        clusters.push_back(triangleCount);
+        std::vector<glm::vec3> clusterCentroids(clusterCount, glm::vec3(0.f));
+        std::vector<glm::vec3> clusterNormals(clusterCount, glm::vec3(0.f));
+        glm::vec3 meshCentroid = glm::vec3(0.f);
+        float meshArea = 0.f;
+        for(int i = 0; i < clusterCount; ++i) {
+            float clusterArea = 0.f;
+            for(int j = clusters[i]; j < clusters[i + 1]; ++j) {
+                glm::vec3 a = getPosition(vertices, indices[j * 3]);
+                glm::vec3 b = getPosition(vertices, indices[j * 3 + 1]);
+                glm::vec3 c = getPosition(vertices, indices[j * 3 + 2]);
+                glm::vec3 normal = glm::cross(b - a, c - a);
+                float area = glm::length(normal);
+                clusterCentroids[i] += (a + b + c) * (area / 3.f);
+                clusterNormals[i] += normal;
+                clusterArea += area;
+            }
+            meshCentroid += clusterCentroids[i];
+            meshArea += clusterArea;
+            if(clusterArea > 0.f)
+                clusterCentroids[i] /= clusterArea;
+        }
+        if(meshArea > 0.f)
+            meshCentroid /= meshArea;
+        std::vector<float> sortKeys(clusterCount);
+        for(int i = 0; i < clusterCount; ++i) {
+            float normalLength = glm::length(clusterNormals[i]);
+            glm::vec3 normal = normalLength > 0.f ? clusterNormals[i] / normalLength : glm::vec3(0.f);
+            sortKeys[i] = glm::dot(clusterCentroids[i] - meshCentroid, normal);
+        }
+        std::vector<int> order(clusterCount);
+        for(int i = 0; i < clusterCount; ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int left, int right) { return sortKeys[left] > sortKeys[right]; });
+        std::vector<uint32_t> result(indexCount);
+        int resultIndex = 0;
+        for(auto cluster : order) {
+            int start = clusters[cluster] * 3;
+            int count = (clusters[cluster + 1] - clusters[cluster]) * 3;
+            std::memcpy(result.data() + resultIndex, indices + start, count * sizeof(uint32_t));
+            resultIndex += count;
+        }
+        float sourceACMR = calculateACMR(indices, indexCount, vertexCount, cacheSize);
+        float ACMR = calculateACMR(result.data(), indexCount, vertexCount, cacheSize);
+        if(ACMR <= sourceACMR * threshold)
+            std::memcpy(indices, result.data(), indexCount * sizeof(uint32_t));
+    }
+
+    int MeshOptimizer::optimizeVertexFetch(float* vertices, int vertexCount, uint32_t* indices, int indexCount) {
+        std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+        uint32_t nextVertex = 0;
+        for(int i = 0; i < indexCount; ++i) {
+            uint32_t& vertex = remap[indices[i]];
+            if(vertex == UINT32_MAX)
+                vertex = nextVertex++;
+            indices[i] = vertex;
+        }
+        std::vector<float> source(vertices, vertices + static_cast<size_t>(vertexCount) * vertexStride);
+        for(int i = 0; i < vertexCount; ++i)
+            if(remap[i] != UINT32_MAX)
+                std::memcpy(vertices + static_cast<size_t>(remap[i]) * vertexStride, source.data() + static_cast<size_t>(i) * vertexStride,
+                    vertexStride * sizeof(float));
+        return static_cast<int>(nextVertex);
+    }
+
+    float MeshOptimizer::calculateACMR(const uint32_t* indices, int indexCount, int vertexCount, int cacheSize) {
+        int triangleCount = indexCount / 3;
+        if(triangleCount == 0)
+            return 0.f;
+        std::vector<int> timestamps(vertexCount, 0);
+        int time = cacheSize + 1;
+        int misses = 0;
+        for(int i = 0; i < indexCount; ++i) {
+            uint32_t vertex = indices[i];
+            if(time - timestamps[vertex] > cacheSize) {
+                timestamps[vertex] = time++;
+                ++misses;
+            }
+        }
+        return static_cast<float>(misses) / triangleCount;
+    }
+
+    uint32_t MeshOptimizer::hashVertex(const float* vertex) {
+        uint32_t hash = 2166136261u;
+        for(int i = 0; i < vertexStride; ++i) {
+            uint32_t bits;
+            std::memcpy(&bits, vertex + i, sizeof(bits));
+            hash = (hash ^ bits) * 16777619u;
+        }
+        return hash;
+    }
+
+    glm::vec3 MeshOptimizer::getPosition(const float* vertices, uint32_t index) {
+        const float* vertex = vertices + static_cast<size_t>(index) * vertexStride;
+        return { vertex[0], vertex[1], vertex[2] };
+    }
+}
\ No newline at end of file
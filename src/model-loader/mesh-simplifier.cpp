@@ -0,0 +1,236 @@
+#include "model-loader/mesh-simplifier.hpp"
+
+namespace TWE {
+    const int MeshSimplifier::vertexStride = 8;
+
+    Quadric::Quadric(const glm::vec3& normal, float distance, float weight)
+    : a2(weight * normal.x * normal.x), b2(weight * normal.y * normal.y), c2(weight * normal.z * normal.z),
+      ab(weight * normal.x * normal.y), ac(weight * normal.x * normal.z), bc(weight * normal.y * normal.z),
+      ad(weight * normal.x * distance), bd(weight * normal.y * distance), cd(weight * normal.z * distance),
+      d2(weight * distance * distance), weight(weight) {}
+
+    Quadric& Quadric::operator+=(const Quadric& quadric) {
+        this->a2 += quadric.a2;
+        this->b2 += quadric.b2;
+        this->c2 += quadric.c2;
+        this->ab += quadric.ab;
+        this->ac += quadric.ac;
+        this->bc += quadric.bc;
+        this->ad += quadric.ad;
+        this->bd += quadric.bd;
+        this->cd += quadric.cd;
+        this->d2 += quadric.d2;
+        this->weight += quadric.weight;
+        return *this;
+    }
+
+    float Quadric::evaluate(const glm::vec3& point) const {
+        float x = point.x, y = point.y, z = point.z;
+        float result = x * x * a2 + y * y * b2 + z * z * c2
+            + 2.f * (x * y * ab + x * z * ac + y * z * bc)
+            + 2.f * (x * ad + y * bd + z * cd) + d2;
+        return result > 0.f ? result : 0.f;
+    }
+
+    std::vector<uint32_t> MeshSimplifier::simplify(const float* vertices, int vertexCount, const uint32_t* indices, int indexCount,
+        int targetIndexCount, float targetError, float* resultError) {
+        std::vector<uint32_t> result(indices, indices + indexCount);
+        float currentError = 0.f;
+        float radius = calculateRadius(vertices, vertexCount);
+        if(resultError)
+            *resultError = 0.f;
+        if(radius <= 0.f || vertexCount == 0)
+            return result;
+        float maxError = targetError * radius;
+        std::vector<bool> locked;
+        classifyVertices(vertices, vertexCount, result, locked);
+        std::vector<Quadric> quadrics;
+        calculateQuadrics(vertices, result, quadrics);
+        quadrics.resize(vertexCount);
+        std::vector<uint32_t> adjacencyOffsets(vertexCount + 1);
+        std::vector<uint32_t> adjacency;
+        std::vector<uint32_t> remap(vertexCount);
+        std::vector<bool> touched(vertexCount);
+        std::vector<MeshCollapseSpecification> collapses;
+        while(static_cast<int>(result.size()) > targetIndexCount) {
+            int resultIndexCount = static_cast<int>(result.size());
+            std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+            for(auto index : result)
+                ++adjacencyOffsets[index + 1];
+            for(int i = 0; i < vertexCount; ++i)
+                adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+            adjacency.resize(resultIndexCount);
+            std::vector<uint32_t> fillOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for(int i = 0; i < resultIndexCount; ++i)
+                adjacency[fillOffsets[result[i]]++] = i / 3;
+            collapses.clear();
+            for(int i = 0; i < resultIndexCount; i += 3)
+                for(int j = 0; j < 3; ++j) {
+                    uint32_t source = result[i + j];
+                    uint32_t target = result[i + (j + 1) % 3];
+                    for(int k = 0; k < 2; ++k, std::swap(source, target)) {
+                        if(locked[source])
+                            continue;
+                        Quadric quadric = quadrics[source];
+                        quadric += quadrics[target];
+                        float weight = quadric.weight > 0.f ? quadric.weight : 1.f;
+                        float error = glm::sqrt(quadric.evaluate(getPosition(vertices, target)) / weight);
+                        if(error <= maxError)
+                            collapses.emplace_back(source, target, error);
+                    }
+                }
+            if(collapses.empty())
+                break;
+            std::sort(collapses.begin(), collapses.end(), [](const MeshCollapseSpecification& left, const MeshCollapseSpecification& right) {
+                return left.error < right.error;
+            });
+            for(int i = 0; i < vertexCount; ++i)
+                remap[i] = i;
+            std::fill(touched.begin(), touched.end(), false);
+            int trianglesToRemove = (resultIndexCount - targetIndexCount) / 3;
+            int removedTriangles = 0;
+            int collapseCount = 0;
+            for(auto& collapse : collapses) {
+                if(touched[collapse.source] || touched[collapse.target])
+                    continue;
+                if(hasFlippedTriangles(vertices, result, adjacencyOffsets, adjacency, collapse.source, collapse.target))
+                    continue;
+                remap[collapse.source] = collapse.target;
+                quadrics[collapse.target] += quadrics[collapse.source];
+                for(uint32_t j = adjacencyOffsets[collapse.source]; j < adjacencyOffsets[collapse.source + 1]; ++j)
+                    for(int k = 0; k < 3; ++k)
+                        touched[result[adjacency[j] * 3 + k]] = true;
+                currentError = glm::max(currentError, collapse.error);
+                ++collapseCount;
+                removedTriangles += 2;
+                if(removedTriangles >= trianglesToRemove)
+                    break;
+            }
+            if(collapseCount == 0)
+                break;
+            int writeIndex = 0;
+            for(int i = 0; i < resultIndexCount; i += 3) {
+                uint32_t a = remap[result[i]];
+                uint32_t b = remap[result[i + 1]];
+                uint32_t c = remap[result[i + 2]];
+                if(a == b || b == c || a == c)
+                    continue;
+                result[writeIndex++] = a;
+                result[writeIndex++] = b;
+                result[writeIndex++] = c;
+            }
+            result.resize(writeIndex);
+        }
+        if(resultError)
+            *resultError = currentError / radius;
+        return result;
+    }
+
+    float MeshSimplifier::calculateRadius(const float* vertices, int vertexCount, glm::vec3* center) {
+        if(vertexCount == 0)
+            return 0.f;
+        glm::vec3 minPosition = getPosition(vertices, 0);
+        glm::vec3 maxPosition = minPosition;
+        for(int i = 1; i < vertexCount; ++i) {
+            glm::vec3 position = getPosition(vertices, i);
+            minPosition = glm::min(minPosition, position);
+            maxPosition = glm::max(maxPosition, position);
+        }
+        glm::vec3 boundsCenter = (minPosition + maxPosition) * 0.5f;
+        float radius = 0.f;
+        for(int i = 0; i < vertexCount; ++i)
+            radius = glm::max(radius, glm::length(getPosition(vertices, i) - boundsCenter));
+        if(center)
+            *center = boundsCenter;
+        return radius;
+    }
+
+    void MeshSimplifier::classifyVertices(const float* vertices, int vertexCount, const std::vector<uint32_t>& indices, std::vector<bool>& locked) {
+        std::vector<uint32_t> positionRemap(vertexCount);
+        std::vector<int> positionUsage(vertexCount, 0);
+        size_t tableSize = 1;
+        while(tableSize < static_cast<size_t>(vertexCount) * 2)
+            tableSize <<= 1;
+        std::vector<uint32_t> table(tableSize, UINT32_MAX);
+        for(int i = 0; i < vertexCount; ++i) {
+            const float* position = vertices + static_cast<size_t>(i) * vertexStride;
+            uint32_t hash = 2166136261u;
+            for(int j = 0; j < 3; ++j) {
+                uint32_t bits;
+                std::memcpy(&bits, position + j, sizeof(bits));
+                hash = (hash ^ bits) * 16777619u;
+            }
+            size_t slot = hash & (tableSize - 1);
+            while(table[slot] != UINT32_MAX
+            && std::memcmp(vertices + static_cast<size_t>(table[slot]) * vertexStride, position, 3 * sizeof(float)) != 0)
+                slot = (slot + 1) & (tableSize - 1);
+            if(table[slot] == UINT32_MAX)
+                table[slot] = i;
+            positionRemap[i] = table[slot];
+            ++positionUsage[table[slot]];
+        }
+        std::unordered_map<uint64_t, int> edges;
+        edges.reserve(indices.size());
+        for(size_t i = 0; i < indices.size(); i += 3)
+            for(int j = 0; j < 3; ++j) {
+                uint64_t a = positionRemap[indices[i + j]];
+                uint64_t b = positionRemap[indices[i + (j + 1) % 3]];
+                ++edges[a < b ? (a << 32) | b : (b << 32) | a];
+            }
+        std::vector<bool> lockedPositions(vertexCount, false);
+        for(auto& [edge, count] : edges)
+            if(count != 2) {
+                lockedPositions[edge >> 32] = true;
+                lockedPositions[edge & UINT32_MAX] = true;
+            }
+        locked.assign(vertexCount, false);
+        for(int i = 0; i < vertexCount; ++i)
+            locked[i] = positionUsage[positionRemap[i]] > 1 || lockedPositions[positionRemap[i]];
+    }
+
+    void MeshSimplifier::calculateQuadrics(const float* vertices, const std::vector<uint32_t>& indices, std::vector<Quadric>& quadrics) {
+        uint32_t vertexCount = 0;
+        for(auto index : indices)
+            vertexCount = glm::max(vertexCount, index + 1);
+        quadrics.assign(vertexCount, {});
+        for(size_t i = 0; i < indices.size(); i += 3) {
+            glm::vec3 a = getPosition(vertices, indices[i]);
+            glm::vec3 b = getPosition(vertices, indices[i + 1]);
+            glm::vec3 c = getPosition(vertices, indices[i + 2]);
+            glm::vec3 normal = glm::cross(b - a, c - a);
+            float area = glm::length(normal);
+            if(area <= 0.f)
+                continue;
+            normal /= area;
+            Quadric quadric(normal, -glm::dot(normal, a), area);
+            for(int j = 0; j < 3; ++j)
+                quadrics[indices[i + j]] += quadric;
+        }
+    }
+
+    bool MeshSimplifier::hasFlippedTriangles(const float* vertices, const std::vector<uint32_t>& indices,
+        const std::vector<uint32_t>& adjacencyOffsets, const std::vector<uint32_t>& adjacency, uint32_t source, uint32_t target) {
+        glm::vec3 targetPosition = getPosition(vertices, target);
+        for(uint32_t i = adjacencyOffsets[source]; i < adjacencyOffsets[source + 1]; ++i) {
+            const uint32_t* triangle = indices.data() + adjacency[i] * 3;
+            if(triangle[0] == target || triangle[1] == target || triangle[2] == target)
+                continue;
+            glm::vec3 positions[3];
+            for(int j = 0; j < 3; ++j)
+                positions[j] = getPosition(vertices, triangle[j]);
+            glm::vec3 normal = glm::cross(positions[1] - positions[0], positions[2] - positions[0]);
+            for(int j = 0; j < 3; ++j)
+                if(triangle[j] == source)
+                    positions[j] = targetPosition;
+            glm::vec3 collapsedNormal = glm::cross(positions[1] - positions[0], positions[2] - positions[0]);
+            if(glm::dot(normal, collapsedNormal) <= 0.f)
+                return true;
+        }
+        return false;
+    }
+
+    glm::vec3 MeshSimplifier::getPosition(const float* vertices, uint32_t index) {
+        const float* vertex = vertices + static_cast<size_t>(index) * vertexStride;
+        return { vertex[0], vertex[1], vertex[2] };
+    }
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "model-loader/model-loader-data.hpp"
 
 namespace TWE {
-    ModelLoaderData::ModelLoaderData(const std::vector<MeshComponent>& meshComponents, const std::string& fullPath)
-    : meshComponents(meshComponents), fullPath(fullPath) {}
+    ModelLoaderData::ModelLoaderData(const std::vector<MeshComponent>& meshComponents, const std::string& fullPath, 
+        const std::vector<MeshOptimizationStatistics>& meshStatistics, const std::vector<MeshBoundsSpecification>& meshBounds, 
+        const std::vector<std::vector<MeshLODDataSpecification>>& meshLODs)
+    : meshComponents(meshComponents), fullPath(fullPath), meshStatistics(meshStatistics), meshBounds(meshBounds), meshLODs(meshLODs) {}
 }
\ No newline at end of file
@@ -1,32 +1,102 @@
 #include "model-loader/model-loader.hpp"
 
 namespace TWE {
+    const int ModelLoader::maxLODCount = 5;
+    const float ModelLoader::maxLODError = 0.05f;
+
+    ModelLoader::~ModelLoader() {
+        clean();
+    }
+
     void ModelLoader::clean() {
         meshes.clear();
+        for(auto& mesh : meshData) {
+            if(mesh.ownsData) {
+                delete[] mesh.vertices;
+                deleteIndices(mesh.indices, mesh.indexType);
+            }
+            for(auto& lod : mesh.lods)
+                if(lod.ownsIndices)
+                    deleteIndices(lod.indices, lod.indexType);
+        }
+        meshData.clear();
+        cacheFile.close();
+        meshStatistics.clear();
+        sceneMeshes.clear();
         filePath.clear();
+        errorString.clear();
         hasTextures = false;
     }
 
-    ModelLoaderData* ModelLoader::loadModel(const std::string& path) {
-        if(!std::filesystem::exists(path))
+    ModelLoaderData* ModelLoader::loadModel(const std::string& path, const MeshOptimizationSpecification& optimizationSpec) {
+        if(!prepareModel(path, optimizationSpec))
             return nullptr;
+        return uploadModel();
+    }
+
+    bool ModelLoader::prepareModel(const std::string& path, const MeshOptimizationSpecification& optimizationSpec) {
+        if(!std::filesystem::exists(path))
+            return false;
         clean();
+        filePath = path;
+        auto cachePath = MeshCache::getCachePath(path);
+        uint64_t sourceHash = MeshCache::calculateHash(path, optimizationSpec);
+        if(MeshCache::read(cachePath, sourceHash, cacheFile, meshData))
+            return true;
+        if(!importModel(path, optimizationSpec))
+            return false;
+        MeshCache::write(cachePath, sourceHash, meshData);
+        return true;
+    }
+
+    ModelLoaderData* ModelLoader::uploadModel() {
+        std::vector<MeshBoundsSpecification> meshBounds;
+        std::vector<std::vector<MeshLODDataSpecification>> meshLODs;
+        meshBounds.reserve(meshData.size());
+        meshLODs.reserve(meshData.size());
+        meshes.reserve(meshData.size());
+        if(meshData.empty())
+            return new ModelLoaderData(meshes, filePath, meshStatistics, meshBounds);
+        std::vector<SubmeshSpecification> submeshes;
+        MeshComponent arena = createArena(submeshes);
+        for(int i = 0; i < meshData.size(); ++i) {
+            ModelMeshSpecification modelSpec(true, filePath, -1, submeshes[i]);
+            meshes.push_back(MeshComponent(arena.getVAO(), arena.getVBO(), arena.getEBO(), "Model mesh", modelSpec, arena.getTexture()));
+            meshBounds.push_back(meshData[i].bounds);
+            meshLODs.push_back(std::move(meshData[i].lods));
+            meshData[i].lods.clear();
+        }
+        return new ModelLoaderData(meshes, filePath, meshStatistics, meshBounds, meshLODs);
+    }
+
+    bool ModelLoader::importModel(const std::string& path, const MeshOptimizationSpecification& optimizationSpec) {
         Assimp::Importer importer;
         const aiScene* scene = importer.ReadFile(path, aiProcess_Triangulate | aiProcess_FlipUVs);
         if(!scene || scene->mFlags && AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode){
-            std::cout << "Error model loading:\n" << importer.GetErrorString() << std::endl;
-            return nullptr;
+            errorString = importer.GetErrorString();
+            return false;
         }
-        filePath = path;
+        this->optimizationSpec = optimizationSpec;
         procNode(scene->mRootNode, scene);
-        return new ModelLoaderData(meshes, path);
+        procMeshes();
+        return true;
+    }
+
+    void ModelLoader::procMeshes() {
+        int meshCount = static_cast<int>(sceneMeshes.size());
+        meshData.resize(meshCount);
+        meshStatistics.resize(meshCount);
+        JobSystem::parallelFor(meshCount, 1, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i) {
+                meshData[i] = procMesh(sceneMeshes[i], meshStatistics[i]);
+                procLODs(meshData[i]);
+            }
+        });
     }
 
-    MeshComponent ModelLoader::procMesh(aiMesh* mesh, const aiScene* scene) {
-        std::vector<GLuint> indices;
+    ModelMeshDataSpecification ModelLoader::procMesh(aiMesh* mesh, MeshOptimizationStatistics& statistics) {
         int vertSize = mesh->mNumVertices * 8;
         float* vertices = new float[vertSize];
-        std::vector<std::string> texturesPath;
         int verticesIndex = 0;
         for(int i = 0; i < mesh->mNumVertices; ++i){
             //vertex
@@ -49,25 +119,158 @@ namespace TWE {
                 vertices[verticesIndex++] = 0.f;
             }
         }
+        int indSize = 0;
+        for(int i = 0; i < mesh->mNumFaces; ++i)
+            if(mesh->mFaces[i].mNumIndices == 3)
+                indSize += 3;
+        uint32_t* indices = new uint32_t[indSize];
+        int index = 0;
         for(int i = 0; i < mesh->mNumFaces; ++i){
-            auto face = mesh->mFaces[i];
-            for(int j = 0 ; j < face.mNumIndices; ++j)
-                indices.push_back(face.mIndices[j]);
+            auto& face = mesh->mFaces[i];
+            if(face.mNumIndices != 3)
+                continue;
+            for(int j = 0 ; j < 3; ++j)
+                indices[index++] = face.mIndices[j];
+        }
+        int vertexCount = mesh->mNumVertices;
+        statistics = MeshOptimizer::optimize(vertices, vertexCount, indices, indSize, optimizationSpec);
+        ModelMeshDataSpecification meshData;
+        meshData.vertices = vertices;
+        meshData.vertexCount = vertexCount;
+        meshData.indexCount = indSize;
+        meshData.bounds.radius = MeshSimplifier::calculateRadius(vertices, vertexCount, &meshData.bounds.center);
+        if(vertexCount <= std::numeric_limits<uint16_t>::max()) {
+            uint16_t* shortIndices = new uint16_t[indSize];
+            for(int i = 0; i < indSize; ++i)
+                shortIndices[i] = static_cast<uint16_t>(indices[i]);
+            delete[] indices;
+            meshData.indices = shortIndices;
+            meshData.indexType = GL_UNSIGNED_SHORT;
+        } else {
+            meshData.indices = indices;
+            meshData.indexType = GL_UNSIGNED_INT;
+        }
+        return meshData;
+    }
+
+    void ModelLoader::procLODs(ModelMeshDataSpecification& mesh) {
+        std::vector<uint32_t> indices(mesh.indexCount);
+        if(mesh.indexType == GL_UNSIGNED_SHORT) {
+            uint16_t* shortIndices = static_cast<uint16_t*>(mesh.indices);
+            for(size_t i = 0; i < indices.size(); ++i)
+                indices[i] = shortIndices[i];
+        } else
+            std::memcpy(indices.data(), mesh.indices, indices.size() * sizeof(uint32_t));
+        float error = 0.f;
+        for(int i = 1; i < maxLODCount; ++i) {
+            float lodError = 0.f;
+            int targetIndexCount = static_cast<int>(indices.size()) / 6 * 3;
+            auto lodIndices = MeshSimplifier::simplify(mesh.vertices, mesh.vertexCount, indices.data(), indices.size(), targetIndexCount, maxLODError, &lodError);
+            if(lodIndices.empty() || lodIndices.size() > indices.size() * 3 / 4)
+                break;
+            error += lodError;
+            MeshOptimizer::optimizeVertexCache(lodIndices.data(), lodIndices.size(), mesh.vertexCount);
+            MeshLODDataSpecification lod;
+            lod.indexCount = static_cast<int>(lodIndices.size());
+            lod.indexType = mesh.indexType;
+            lod.error = error;
+            if(mesh.indexType == GL_UNSIGNED_SHORT) {
+                uint16_t* shortIndices = new uint16_t[lodIndices.size()];
+                for(size_t j = 0; j < lodIndices.size(); ++j)
+                    shortIndices[j] = static_cast<uint16_t>(lodIndices[j]);
+                lod.indices = shortIndices;
+            } else {
+                uint32_t* intIndices = new uint32_t[lodIndices.size()];
+                std::memcpy(intIndices, lodIndices.data(), lodIndices.size() * sizeof(uint32_t));
+                lod.indices = intIndices;
+            }
+            mesh.lods.push_back(lod);
+            indices = std::move(lodIndices);
+        }
+    }
+
+    void ModelLoader::deleteIndices(void* indices, uint32_t indexType) {
+        if(indexType == GL_UNSIGNED_SHORT)
+            delete[] static_cast<uint16_t*>(indices);
+        else
+            delete[] static_cast<uint32_t*>(indices);
+    }
+
+    MeshComponent ModelLoader::createArena(std::vector<SubmeshSpecification>& submeshes) {
+        int vertexCount = 0;
+        int indexCount = 0;
+        bool isShortIndices = true;
+        submeshes.reserve(meshData.size());
+        for(auto& mesh : meshData) {
+            submeshes.emplace_back(indexCount, mesh.indexCount, vertexCount, mesh.vertexCount);
+            vertexCount += mesh.vertexCount;
+            indexCount += mesh.indexCount;
+            isShortIndices = isShortIndices && mesh.indexType == GL_UNSIGNED_SHORT;
         }
-        int indSize = indices.size();
-        uint32_t* copyIndices = new uint32_t[indSize];
-        for(int i = 0; i < indSize; ++i)
-            copyIndices[i] = indices[i];
         ModelMeshSpecification modelSpec(true, filePath, -1);
-        return MeshComponent(vertices, vertSize * sizeof(GLfloat), copyIndices, indSize * sizeof(GLuint), "Model mesh", modelSpec);
+        int indexSize = isShortIndices ? sizeof(uint16_t) : sizeof(uint32_t);
+        if(isContiguous()) {
+            auto& mesh = meshData.front();
+            MeshComponent arena(mesh.vertices, vertexCount * VertexLayout::sourceStride * sizeof(GLfloat), mesh.indices, indexCount * indexSize, 
+                mesh.indexType, VertexLayout::createCompact(), "Model mesh", modelSpec, {}, false);
+            for(auto& contiguousMesh : meshData) {
+                contiguousMesh.vertices = nullptr;
+                contiguousMesh.indices = nullptr;
+            }
+            return arena;
+        }
+        float* vertices = new float[static_cast<size_t>(vertexCount) * VertexLayout::sourceStride];
+        uint16_t* shortIndices = isShortIndices ? new uint16_t[indexCount] : nullptr;
+        uint32_t* intIndices = isShortIndices ? nullptr : new uint32_t[indexCount];
+        for(int i = 0; i < meshData.size(); ++i) {
+            auto& mesh = meshData[i];
+            auto& submesh = submeshes[i];
+            std::memcpy(vertices + static_cast<size_t>(submesh.baseVertex) * VertexLayout::sourceStride, mesh.vertices, 
+                static_cast<size_t>(mesh.vertexCount) * VertexLayout::sourceStride * sizeof(float));
+            if(mesh.indexType == GL_UNSIGNED_SHORT) {
+                uint16_t* meshIndices = static_cast<uint16_t*>(mesh.indices);
+                if(isShortIndices)
+                    std::memcpy(shortIndices + submesh.indexOffset, meshIndices, mesh.indexCount * sizeof(uint16_t));
+                else
+                    for(int j = 0; j < mesh.indexCount; ++j)
+                        intIndices[submesh.indexOffset + j] = meshIndices[j];
+            } else
+                std::memcpy(intIndices + submesh.indexOffset, mesh.indices, mesh.indexCount * sizeof(uint32_t));
+            if(mesh.ownsData) {
+                delete[] mesh.vertices;
+                deleteIndices(mesh.indices, mesh.indexType);
+            }
+            mesh.vertices = nullptr;
+            mesh.indices = nullptr;
+        }
+        void* indices = isShortIndices ? static_cast<void*>(shortIndices) : static_cast<void*>(intIndices);
+        return MeshComponent(vertices, vertexCount * VertexLayout::sourceStride * sizeof(GLfloat), indices, indexCount * indexSize, 
+            isShortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, VertexLayout::createCompact(), "Model mesh", modelSpec, {}, true);
+    }
+
+    bool ModelLoader::isContiguous() const noexcept {
+        if(meshData.empty() || meshData.front().ownsData)
+            return false;
+        for(size_t i = 1; i < meshData.size(); ++i) {
+            auto& previous = meshData[i - 1];
+            auto& mesh = meshData[i];
+            size_t indexSize = previous.indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+            if(mesh.ownsData || mesh.indexType != previous.indexType
+                || mesh.vertices != previous.vertices + static_cast<size_t>(previous.vertexCount) * VertexLayout::sourceStride
+                || static_cast<uint8_t*>(mesh.indices) != static_cast<uint8_t*>(previous.indices) + previous.indexCount * indexSize)
+                return false;
+        }
+        return true;
     }
 
     void ModelLoader::procNode(aiNode* node, const aiScene* scene) {
         for(int i = 0; i < node->mNumMeshes; ++i){
-            aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-            meshes.push_back(procMesh(mesh, scene));
+            sceneMeshes.push_back(scene->mMeshes[node->mMeshes[i]]);
         }
         for(int i = 0; i < node->mNumChildren; ++i)
             procNode(node->mChildren[i], scene);
     }
+
+    const std::vector<ModelMeshDataSpecification>& ModelLoader::getMeshData() const noexcept { return meshData; }
+    const std::string& ModelLoader::getErrorString() const noexcept { return errorString; }
 }
\ No newline at end of file
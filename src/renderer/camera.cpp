@@ -50,4 +50,10 @@ namespace TWE {
         "Perspective",
         "Orthographic"
     };
-}
+
+    std::vector<std::string> renderPaths = {
+        "Default",
+        "Forward",
+        "Deferred"
+    };
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "renderer/deferred-renderer.hpp"
+
+namespace TWE {
+    const FBOAttachmentSpecification DeferredRenderer::gBufferAttachments = { FBOTextureFormat::RGBA8, FBOTextureFormat::R32I, FBOTextureFormat::RGBA16F,
+        FBOTextureFormat::RGBA16F, FBOTextureFormat::DEPTH24STENCIL8 };
+    const float DeferredRenderer::lightCutoff = 1.f / 256.f;
+    std::vector<const RendererSpecification*> DeferredRenderer::forwardItems;
+    std::unique_ptr<Shader> DeferredRenderer::gBufferShader;
+    std::unique_ptr<Shader> DeferredRenderer::lightShader;
+    std::string DeferredRenderer::defaultVertPath;
+    std::string DeferredRenderer::defaultFragPath;
+    uint32_t DeferredRenderer::vao = 0;
+
+    void DeferredRenderer::init(const std::filesystem::path& rootPath) {
+        std::string rootPathStr = rootPath.string();
+        defaultVertPath = rootPathStr + SHADER_PATHS[ShaderIndices::DEFAULT_VERT];
+        defaultFragPath = rootPathStr + SHADER_PATHS[ShaderIndices::DEFAULT_FRAG];
+        gBufferShader = std::make_unique<Shader>(defaultVertPath.c_str(), (rootPathStr + SHADER_PATHS[ShaderIndices::GBUFFER_FRAG]).c_str());
+        lightShader = std::make_unique<Shader>((rootPathStr + SHADER_PATHS[ShaderIndices::DEFERRED_VERT]).c_str(),
+            (rootPathStr + SHADER_PATHS[ShaderIndices::DEFERRED_FRAG]).c_str());
+        lightShader->setUniform("albedoMap", 0);
+        lightShader->setUniform("idMap", 1);
+        lightShader->setUniform("normalMap", 2);
+        lightShader->setUniform("materialMap", 3);
+        lightShader->setUniform("depthMap", 4);
+        lightShader->setUniform("light.shadowMap", 31);
+        glGenVertexArrays(1, &vao);
+    }
+
+    void DeferredRenderer::render(std::vector<RenderLightSpecification>& lights, const SceneViewSpecification& sceneView, const std::vector<RenderItemSpecification>& renderItems, uint32_t viewMask,
+    const glm::vec4& viewport, int lightsCount) {
+        int framebuffer = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+        uint32_t width = static_cast<uint32_t>(viewport.z);
+        uint32_t height = static_cast<uint32_t>(viewport.w);
+        auto gBuffer = RenderTargetPool::acquire(width, height, gBufferAttachments);
+        gBuffer->bind();
+        glClearColor(0.f, 0.f, 0.f, 0.f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        static const int clearId[] = { -1, -1, -1, -1 };
+        glClearBufferiv(GL_COLOR, 1, clearId);
+        auto& camera = sceneView.camera;
+        forwardItems.clear();
+        for(auto& renderItem : renderItems) {
+            if(!(renderItem.viewMask & viewMask))
+                continue;
+            if(isDeferrable(renderItem.rendererSpec))
+                renderGeometry(renderItem.rendererSpec, camera);
+            else
+                forwardItems.push_back(&renderItem.rendererSpec);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        Renderer::setViewport(static_cast<int>(viewport.x), static_cast<int>(viewport.y), width, height);
+        renderLights(lights, camera, viewport, *gBuffer);
+        for(auto rendererSpec : forwardItems)
+            Renderer::render3D(*rendererSpec, camera.position, camera.view, camera.projection, camera.projectionView, lightsCount);
+    }
+
+    bool DeferredRenderer::isDeferrable(const RendererSpecification& rendererSpec) {
+        auto& shader = rendererSpec.shader;
+        return gBufferShader && shader->getVertPath() == defaultVertPath && shader->getFragPath() == defaultFragPath;
+    }
+
+    void DeferredRenderer::renderGeometry(const RendererSpecification& rendererSpec, const SceneCameraSpecification& camera) {
+        auto& model = rendererSpec.model;
+        auto& texture = rendererSpec.texture;
+        int lodIndex = Renderer::selectLOD(rendererSpec.lodChain.get(), rendererSpec.lodIndex, model, camera.position, camera.projection);
+        Renderer::requestTextureLevels(rendererSpec, camera.position, camera.projection);
+        gBufferShader->setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::MODEL], model);
+        gBufferShader->setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::MVP], camera.projectionView * model);
+        gBufferShader->setUniform("hasTexture", !texture->getAttachments().textureSpecifications.empty());
+        gBufferShader->setUniform("id", rendererSpec.entityId);
+        Renderer::setMaterialUniform(*gBufferShader, rendererSpec.material);
+        Renderer::setVertexLayout(*gBufferShader, *rendererSpec.vbo);
+        texture->bind();
+        Renderer::drawMesh(rendererSpec, lodIndex);
+    }
+
+    void DeferredRenderer::renderLights(std::vector<RenderLightSpecification>& lights, const SceneCameraSpecification& camera, const glm::vec4& viewport, FBO& gBuffer) {
+        for(uint32_t i = 0; i < 4; ++i) {
+            glActiveTexture(GL_TEXTURE0 + i);
+            glBindTexture(GL_TEXTURE_2D, gBuffer.getColorAttachment(i));
+        }
+        glActiveTexture(GL_TEXTURE4);
+        glBindTexture(GL_TEXTURE_2D, gBuffer.getDepthAttachment());
+        lightShader->setUniform("viewportOffset", glm::vec2(viewport.x, viewport.y));
+        lightShader->setUniform("viewportSize", glm::vec2(viewport.z, viewport.w));
+        lightShader->setUniform("inverseProjectionView", glm::inverse(camera.projectionView));
+        lightShader->setUniform("viewPos", camera.position);
+        lightShader->setUniform("isBasePass", true);
+        glBindVertexArray(vao);
+        glDepthFunc(GL_ALWAYS);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        lightShader->setUniform("isBasePass", false);
+        glDepthMask(GL_FALSE);
+        glColorMaski(1, GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glBlendFunc(GL_ONE, GL_ONE);
+        glEnable(GL_SCISSOR_TEST);
+        for(auto& light : lights) {
+            glm::ivec4 scissor;
+            if(!getLightScissor(light.lightComponent, light.position, camera.projectionView, viewport, scissor))
+                continue;
+            glScissor(scissor.x, scissor.y, scissor.z, scissor.w);
+            setLight(light);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        glDisable(GL_SCISSOR_TEST);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        glColorMaski(1, GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glDepthMask(GL_TRUE);
+        glDepthFunc(GL_LESS);
+        glBindVertexArray(0);
+    }
+
+    void DeferredRenderer::setLight(RenderLightSpecification& light) {
+        auto& lightComponent = light.lightComponent;
+        lightShader->setUniform("light.pos", light.position);
+        lightShader->setUniform("light.direction", light.forward);
+        lightShader->setUniform("light.color", lightComponent.getColor());
+        lightShader->setUniform("light.cutOff", glm::cos(glm::radians(lightComponent.getInnerRadius())));
+        lightShader->setUniform("light.outerCutOff", glm::cos(glm::radians(lightComponent.getOuterRadius())));
+        lightShader->setUniform("light.fading.constant", lightComponent.getConstant());
+        lightShader->setUniform("light.fading.linear", lightComponent.getLinear());
+        lightShader->setUniform("light.fading.quadratic", lightComponent.getQuadratic());
+        lightShader->setUniform("light.type.dir", lightComponent.getType() == LightType::Dir);
+        lightShader->setUniform("light.type.point", lightComponent.getType() == LightType::Point);
+        lightShader->setUniform("light.type.spot", lightComponent.getType() == LightType::Spot);
+        bool castShadows = lightComponent.getCastShadows() && lightComponent.getFBO();
+        lightShader->setUniform("light.castShadows", castShadows);
+        if(!castShadows)
+            return;
+        glm::mat4 lightView = glm::lookAt(light.position, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f});
+        lightShader->setUniform("light.lightSpaceMat", lightComponent.getLightProjection() * lightView);
+        glActiveTexture(GL_TEXTURE31);
+        glBindTexture(GL_TEXTURE_2D, lightComponent.getDepthTextureId());
+    }
+
+    bool DeferredRenderer::getLightScissor(const LightComponent& lightComponent, const glm::vec3& center, const glm::mat4& projectionView,
+    const glm::vec4& viewport, glm::ivec4& scissor) {
+        scissor = glm::ivec4(viewport);
+        if(lightComponent.getType() == LightType::Dir)
+            return true;
+        glm::vec3 color = lightComponent.getColor();
+        float maxColor = glm::max(color.r, glm::max(color.g, color.b));
+        if(maxColor <= 0.f)
+            return false;
+        float constant = lightComponent.getConstant() - maxColor / lightCutoff;
+        float linear = lightComponent.getLinear();
+        float quadratic = lightComponent.getQuadratic();
+        float radius;
+        if(quadratic > 0.f)
+            radius = (-linear + glm::sqrt(linear * linear - 4.f * quadratic * constant)) / (2.f * quadratic);
+        else if(linear > 0.f)
+            radius = -constant / linear;
+        else
+            return true;
+        if(radius <= 0.f)
+            return false;
+        glm::vec2 minBound(1.f);
+        glm::vec2 maxBound(-1.f);
+        for(int i = 0; i < 8; ++i) {
+            glm::vec3 corner = center + radius * glm::vec3(i & 1 ? 1.f : -1.f, i & 2 ? 1.f : -1.f, i & 4 ? 1.f : -1.f);
+            glm::vec4 clip = projectionView * glm::vec4(corner, 1.f);
+            if(clip.w <= 0.0001f)
+                return true;
+            glm::vec2 ndc = glm::vec2(clip) / clip.w;
+            minBound = glm::min(minBound, ndc);
+            maxBound = glm::max(maxBound, ndc);
+        }
+        minBound = glm::clamp(minBound, glm::vec2(-1.f), glm::vec2(1.f));
+        maxBound = glm::clamp(maxBound, glm::vec2(-1.f), glm::vec2(1.f));
+        if(minBound.x >= maxBound.x || minBound.y >= maxBound.y)
+            return false;
+        glm::vec2 size(viewport.z, viewport.w);
+        glm::ivec2 start = glm::ivec2(glm::floor((minBound * 0.5f + 0.5f) * size));
+        glm::ivec2 end = glm::ivec2(glm::ceil((maxBound * 0.5f + 0.5f) * size));
+        scissor = { static_cast<int>(viewport.x) + start.x, static_cast<int>(viewport.y) + start.y, end.x - start.x, end.y - start.y };
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "renderer/dynamic-resolution.hpp"
+
+namespace TWE {
+    const float DynamicResolution::minScale = 0.5f;
+    const float DynamicResolution::maxScale = 1.f;
+    const float DynamicResolution::scaleStep = 0.05f;
+    const float DynamicResolution::frameTimeSmoothing = 0.1f;
+    const float DynamicResolution::headroom = 0.15f;
+    const int DynamicResolution::adjustDelay = 30;
+    const int DynamicResolution::queryCount = 4;
+    std::vector<uint32_t> DynamicResolution::queries;
+    int DynamicResolution::queryIndex = 0;
+    int DynamicResolution::pendingQueryCount = 0;
+    bool DynamicResolution::isTiming = false;
+    bool DynamicResolution::isEnabled = true;
+    float DynamicResolution::targetFrameTime = 1.f / 60.f;
+    float DynamicResolution::averageGPUTime = 1.f / 60.f;
+    float DynamicResolution::scale = 1.f;
+    int DynamicResolution::framesSinceAdjust = 0;
+
+    void DynamicResolution::update() {
+        while(pendingQueryCount > 0) {
+            uint32_t query = queries[(queryIndex - pendingQueryCount + queryCount) % queryCount];
+            GLint isAvailable = GL_FALSE;
+            glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+            if(!isAvailable)
+                break;
+            GLuint64 elapsedTime = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsedTime);
+            --pendingQueryCount;
+            if(isEnabled)
+                adjust(static_cast<float>(elapsedTime * 1e-9));
+        }
+    }
+
+    void DynamicResolution::beginGPUTimer() {
+        if(!isEnabled || pendingQueryCount == queryCount)
+            return;
+        if(queries.empty()) {
+            queries.resize(queryCount);
+            glGenQueries(queryCount, queries.data());
+        }
+        glBeginQuery(GL_TIME_ELAPSED, queries[queryIndex]);
+        isTiming = true;
+    }
+
+    void DynamicResolution::endGPUTimer() {
+        if(!isTiming)
+            return;
+        glEndQuery(GL_TIME_ELAPSED);
+        queryIndex = (queryIndex + 1) % queryCount;
+        ++pendingQueryCount;
+        isTiming = false;
+    }
+
+    void DynamicResolution::adjust(float gpuTime) {
+        averageGPUTime = glm::mix(averageGPUTime, glm::clamp(gpuTime, 0.f, 0.25f), frameTimeSmoothing);
+        if(++framesSinceAdjust < adjustDelay)
+            return;
+        bool isOverBudget = averageGPUTime > targetFrameTime;
+        bool hasHeadroom = averageGPUTime < targetFrameTime * (1.f - headroom);
+        if(!isOverBudget && !hasHeadroom)
+            return;
+        float desiredScale = scale * std::sqrt(targetFrameTime / std::max(averageGPUTime, 0.0001f));
+        desiredScale = std::round(desiredScale / scaleStep) * scaleStep;
+        if(isOverBudget)
+            desiredScale = std::min(desiredScale, scale - scaleStep);
+        else
+            desiredScale = std::max(desiredScale, scale + scaleStep);
+        desiredScale = glm::clamp(desiredScale, minScale, maxScale);
+        if(desiredScale != scale) {
+            scale = desiredScale;
+            framesSinceAdjust = 0;
+        }
+    }
+
+    void DynamicResolution::setIsEnabled(bool isEnabled) {
+        DynamicResolution::isEnabled = isEnabled;
+        if(!isEnabled)
+            scale = 1.f;
+    }
+
+    void DynamicResolution::setTargetFrameTime(float targetFrameTime) {
+        DynamicResolution::targetFrameTime = std::max(targetFrameTime, 0.001f);
+    }
+
+    FBOSizeSpecification DynamicResolution::getScaledSize(uint32_t width, uint32_t height) {
+        return { std::max(static_cast<uint32_t>(width * scale), 1u), std::max(static_cast<uint32_t>(height * scale), 1u) };
+    }
+
+    bool DynamicResolution::getIsEnabled() noexcept { return isEnabled; }
+    float DynamicResolution::getTargetFrameTime() noexcept { return targetFrameTime; }
+    float DynamicResolution::getScale() noexcept { return scale; }
+}
\ No newline at end of file
@@ -2,21 +2,37 @@
 
 namespace TWE {
     EBO::EBO(uint32_t* indices, long int size, uint32_t drawType)
-    : _indices(indices), _size(size) {
+    : EBO(static_cast<void*>(indices), size, drawType, GL_UNSIGNED_INT) {}
+
+    EBO::EBO(void* indices, long int size, uint32_t drawType, uint32_t indexType, bool ownsIndices)
+    : _indices(indices), _size(size), _indexType(indexType), _ownsIndices(ownsIndices) {
         glGenBuffers(1, &_id);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _id);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, indices, drawType);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, nullptr, drawType);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        _uploadTicket = UploadManager::uploadBuffer(_id, indices, size);
     }
 
     EBO::EBO(const EBO& ebo) {
         this->_id = ebo._id;
         this->_indices = ebo._indices;
         this->_size = ebo._size;
+        this->_indexType = ebo._indexType;
+        this->_ownsIndices = false;
+        this->_uploadTicket = ebo._uploadTicket;
     }
 
     EBO::~EBO() {
-        clean();
+        if(JobSystem::isMainThread())
+            clean();
+        else {
+            uint32_t id = _id;
+            JobSystem::submit([id]() {
+                UploadManager::cancel(UploadTargetType::Buffer, id);
+                glDeleteBuffers(1, &id);
+            }, {}, JobAffinity::MainThread);
+        }
+        releaseIndices();
     }
 
     void EBO::bind(){
@@ -28,10 +44,27 @@ namespace TWE {
     }
 
     void EBO::clean(){
+        UploadManager::cancel(UploadTargetType::Buffer, _id);
         glDeleteBuffers(1, &_id);
     }
 
+    void EBO::releaseIndices() {
+        if(_ownsIndices) {
+            if(_indexType == GL_UNSIGNED_SHORT)
+                delete[] static_cast<uint16_t*>(_indices);
+            else
+                delete[] static_cast<uint32_t*>(_indices);
+        }
+        _indices = nullptr;
+    }
+
     uint32_t EBO::getId() { return _id; }
-    uint32_t* EBO::getIndices() { return _indices; }
+    uint32_t* EBO::getIndices() { return _indexType == GL_UNSIGNED_INT ? static_cast<uint32_t*>(_indices) : nullptr; }
+    void* EBO::getData() { return _indices; }
     long int EBO::getSize() { return _size; }
+    uint32_t EBO::getIndexType() { return _indexType; }
+    int EBO::getIndexSize() { return _indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t); }
+    int EBO::getCount() { return static_cast<int>(_size / getIndexSize()); }
+    long int EBO::getCPUSize() { return _indices ? _size : 0; }
+    bool EBO::getIsUploaded() { return UploadManager::isUploaded(_uploadTicket); }
 }
\ No newline at end of file
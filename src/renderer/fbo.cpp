@@ -1,20 +1,39 @@
 #include "renderer/fbo.hpp"
 
 namespace TWE {
+    const uint32_t FBO::capacityStep = 128;
+    const float FBO::minCapacityUsage = 0.15f;
+
     FBO::FBO(uint32_t width, uint32_t height, const FBOAttachmentSpecification& attachments)
     : _attachments(attachments) {
         _size = { width, height };
+        _capacity = _size;
         for(auto& specification : _attachments.textureSpecifications) {
             if(specification.textureFormat == FBOTextureFormat::DEPTH24STENCIL8)
                 _depthSpecification = specification;
             else
                 _colorSpecifications.push_back(specification);
         }
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        JobSystem::runOnMainThread([this]() { create(); });
+        #else
         create();
+        #endif
     }
 
     FBO::~FBO() {
-        clean();
+        if(JobSystem::isMainThread()) {
+            clean();
+            return;
+        }
+        uint32_t id = _id;
+        uint32_t depthAttachment = _depthAttachment;
+        std::vector<uint32_t> colorAttachments = _colorAttachments;
+        JobSystem::submit([id, depthAttachment, colorAttachments]() {
+            glDeleteFramebuffers(1, &id);
+            glDeleteTextures(colorAttachments.size(), colorAttachments.data());
+            glDeleteTextures(1, &depthAttachment);
+        }, {}, JobAffinity::MainThread);
     }
 
     void FBO::bind() {
@@ -35,11 +54,24 @@ namespace TWE {
     }
 
     void FBO::resize(uint32_t width, uint32_t height) {
-        _size = { width, height };
+        _size = { std::max(width, 1u), std::max(height, 1u) };
+        bool isFitting = _size.width <= _capacity.width && _size.height <= _capacity.height;
+        float usage = static_cast<float>(_size.width) * _size.height / (static_cast<float>(_capacity.width) * _capacity.height);
+        if(isFitting && usage >= minCapacityUsage)
+            return;
+        _capacity = { (_size.width + capacityStep - 1) / capacityStep * capacityStep, (_size.height + capacityStep - 1) / capacityStep * capacityStep };
         clean();
         create();
     }
 
+    void FBO::blit(uint32_t targetId, uint32_t width, uint32_t height) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, _id);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, targetId);
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glBlitFramebuffer(0, 0, _size.width, _size.height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        glBindFramebuffer(GL_FRAMEBUFFER, targetId);
+    }
+
     void FBO::attachColorTexture(uint32_t id, uint32_t index, uint32_t inFormat, uint32_t outFormat, uint32_t width, uint32_t height) {
         glBindTexture(GL_TEXTURE_2D, id);
         glTexImage2D(GL_TEXTURE_2D, 0, inFormat, width, height, 0, outFormat, GL_UNSIGNED_BYTE, nullptr);
@@ -74,10 +106,13 @@ namespace TWE {
             for(int i = 0; i < colorAttachmentsSize; ++i) {
                 switch (_colorSpecifications[i].textureFormat) {
                 case FBOTextureFormat::R32I:
-                    attachColorTexture(_colorAttachments[i], i, GL_R32I, GL_RED_INTEGER, _size.width, _size.height);
+                    attachColorTexture(_colorAttachments[i], i, GL_R32I, GL_RED_INTEGER, _capacity.width, _capacity.height);
                     break;
                 case FBOTextureFormat::RGBA8:
-                    attachColorTexture(_colorAttachments[i], i, GL_RGBA8, GL_RGBA, _size.width, _size.height);
+                    attachColorTexture(_colorAttachments[i], i, GL_RGBA8, GL_RGBA, _capacity.width, _capacity.height);
+                    break;
+                case FBOTextureFormat::RGBA16F:
+                    attachColorTexture(_colorAttachments[i], i, GL_RGBA16F, GL_RGBA, _capacity.width, _capacity.height);
                     break;
                 }
             }
@@ -86,13 +121,15 @@ namespace TWE {
             glGenTextures(1, &_depthAttachment);
             switch (_depthSpecification.textureFormat) {
                 case FBOTextureFormat::DEPTH24STENCIL8:
-                    attachDepthTexture(_depthAttachment, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, _size.width, _size.height);
+                    attachDepthTexture(_depthAttachment, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, _capacity.width, _capacity.height);
                     break;
             }
         }
         if(_colorAttachments.size() > 1) {
-            static const uint32_t buffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
-            glDrawBuffers(_colorAttachments.size(), buffers);
+            std::vector<uint32_t> buffers(_colorAttachments.size());
+            for(uint32_t i = 0; i < buffers.size(); ++i)
+                buffers[i] = GL_COLOR_ATTACHMENT0 + i;
+            glDrawBuffers(buffers.size(), buffers.data());
         } else if(_colorAttachments.empty())
             glDrawBuffer(GL_NONE);
         unbind();
@@ -109,6 +146,7 @@ namespace TWE {
 
     uint32_t FBO::getId() const noexcept { return _id; }
     const FBOSizeSpecification& FBO::getSize() const noexcept { return _size; }
+    const FBOSizeSpecification& FBO::getCapacity() const noexcept { return _capacity; }
     FBOAttachmentSpecification& FBO::getAttachments() { return _attachments; }
     uint32_t FBO::getColorAttachment(uint32_t index) const noexcept { return _colorAttachments[index]; }
     uint32_t FBO::getDepthAttachment() const noexcept { return _depthAttachment; }
@@ -0,0 +1,51 @@
+#include "renderer/render-target-pool.hpp"
+
+namespace TWE {
+    const uint64_t RenderTargetPool::evictionDelay = 300;
+    std::vector<RenderTargetSpecification>* RenderTargetPool::renderTargets = new std::vector<RenderTargetSpecification>();
+    uint64_t RenderTargetPool::frame = 0;
+
+    std::shared_ptr<FBO> RenderTargetPool::acquire(uint32_t width, uint32_t height, const FBOAttachmentSpecification& attachments) {
+        auto formats = getFormats(attachments);
+        RenderTargetSpecification* bestTarget = nullptr;
+        for(auto& renderTarget : *renderTargets) {
+            if(renderTarget.fbo.use_count() > 1 || renderTarget.formats != formats)
+                continue;
+            auto& capacity = renderTarget.fbo->getCapacity();
+            bool isFitting = width <= capacity.width && height <= capacity.height;
+            if(isFitting) {
+                bestTarget = &renderTarget;
+                break;
+            }
+            if(!bestTarget)
+                bestTarget = &renderTarget;
+        }
+        if(!bestTarget) {
+            renderTargets->emplace_back(std::make_shared<FBO>(width, height, attachments), formats, frame);
+            return renderTargets->back().fbo;
+        }
+        bestTarget->fbo->resize(width, height);
+        bestTarget->lastUsedFrame = frame;
+        return bestTarget->fbo;
+    }
+
+    void RenderTargetPool::update() {
+        ++frame;
+        renderTargets->erase(std::remove_if(renderTargets->begin(), renderTargets->end(), [](const RenderTargetSpecification& renderTarget) {
+            return renderTarget.fbo.use_count() == 1 && frame - renderTarget.lastUsedFrame > evictionDelay;
+        }), renderTargets->end());
+    }
+
+    void RenderTargetPool::clear() {
+        renderTargets->clear();
+    }
+
+    std::vector<FBOTextureFormat> RenderTargetPool::getFormats(const FBOAttachmentSpecification& attachments) {
+        std::vector<FBOTextureFormat> formats;
+        for(auto& specification : attachments.textureSpecifications)
+            formats.push_back(specification.textureFormat);
+        return formats;
+    }
+
+    size_t RenderTargetPool::getCount() { return renderTargets->size(); }
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "renderer/render-thread.hpp"
+
+namespace TWE {
+    const std::chrono::milliseconds RenderThread::idleTimeout(1);
+
+    RenderThread::RenderThread(GLFWwindow* window, const std::function<void(int)>& renderFrame)
+    : _window(window), _renderFrame(renderFrame), _captureIndex(0), _renderIndex(-1), _isStarted(false), _isRunning(true) {
+        glfwMakeContextCurrent(nullptr);
+        _thread = std::thread(&RenderThread::loop, this);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _isStarted; });
+    }
+
+    RenderThread::~RenderThread() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isRunning = false;
+        }
+        _condition.notify_all();
+        _thread.join();
+        glfwMakeContextCurrent(_window);
+        JobSystem::setMainThread();
+        JobSystem::executeMainThreadJobs();
+        Renderer::clearSnapshot(_snapshots[0]);
+        Renderer::clearSnapshot(_snapshots[1]);
+    }
+
+    void RenderThread::submit() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _renderIndex < 0; });
+        _renderIndex = _captureIndex;
+        _captureIndex = 1 - _captureIndex;
+        lock.unlock();
+        _condition.notify_all();
+    }
+
+    void RenderThread::loop() {
+        glfwMakeContextCurrent(_window);
+        JobSystem::setMainThread();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStarted = true;
+        }
+        _condition.notify_all();
+        while(true) {
+            JobSystem::executeMainThreadJobs();
+            std::unique_lock<std::mutex> lock(_mutex);
+            if(!_condition.wait_for(lock, idleTimeout, [this]() { return _renderIndex >= 0 || !_isRunning; }))
+                continue;
+            if(_renderIndex < 0)
+                break;
+            int frameIndex = _renderIndex;
+            lock.unlock();
+            _renderFrame(frameIndex);
+            Renderer::clearSnapshot(_snapshots[frameIndex]);
+            lock.lock();
+            _renderIndex = -1;
+            lock.unlock();
+            _condition.notify_all();
+        }
+        JobSystem::executeMainThreadJobs();
+        glfwMakeContextCurrent(nullptr);
+    }
+
+    int RenderThread::getCaptureIndex() const noexcept { return _captureIndex; }
+    RenderSnapshotSpecification& RenderThread::getSnapshot(int index) noexcept { return _snapshots[index]; }
+}
\ No newline at end of file
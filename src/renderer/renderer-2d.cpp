@@ -0,0 +1,161 @@
+#include "renderer/renderer-2d.hpp"
+
+namespace TWE {
+    std::vector<Batch2DItemSpecification> Renderer2D::items;
+    std::vector<Batch2DVertexSpecification> Renderer2D::vertices;
+    std::vector<uint32_t> Renderer2D::indices;
+    std::vector<uint32_t> Renderer2D::textureSlots;
+    std::unique_ptr<Shader> Renderer2D::shader;
+    std::string Renderer2D::uiVertPath;
+    std::string Renderer2D::uiFragPath;
+    uint32_t Renderer2D::vao = 0;
+    uint32_t Renderer2D::vbo = 0;
+    uint32_t Renderer2D::ebo = 0;
+    int Renderer2D::drawCount = 0;
+    const int Renderer2D::maxVertices = 4096;
+    const int Renderer2D::maxIndices = 6144;
+    const int Renderer2D::maxMeshVertices = 64;
+    const int Renderer2D::maxTextureSlots = 16;
+
+    void Renderer2D::init(const std::filesystem::path& rootPath) {
+        std::string rootPathStr = rootPath.string();
+        uiVertPath = rootPathStr + SHADER_PATHS[ShaderIndices::UI_VERT];
+        uiFragPath = rootPathStr + SHADER_PATHS[ShaderIndices::UI_FRAG];
+        shader = std::make_unique<Shader>((rootPathStr + SHADER_PATHS[ShaderIndices::BATCH_2D_VERT]).c_str(),
+            (rootPathStr + SHADER_PATHS[ShaderIndices::BATCH_2D_FRAG]).c_str());
+        for(int i = 0; i < maxTextureSlots; ++i)
+            shader->setUniform(("textures[" + std::to_string(i) + "]").c_str(), i);
+        vertices.reserve(maxVertices);
+        indices.reserve(maxIndices);
+        textureSlots.reserve(maxTextureSlots);
+        glGenVertexArrays(1, &vao);
+        glGenBuffers(1, &vbo);
+        glGenBuffers(1, &ebo);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, maxVertices * sizeof(Batch2DVertexSpecification), nullptr, GL_STREAM_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, maxIndices * sizeof(uint32_t), nullptr, GL_STREAM_DRAW);
+        GLsizei stride = sizeof(Batch2DVertexSpecification);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(Batch2DVertexSpecification, position));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(Batch2DVertexSpecification, uv));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(Batch2DVertexSpecification, color));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(Batch2DVertexSpecification, textureSlot));
+        glEnableVertexAttribArray(3);
+        glVertexAttribIPointer(4, 1, GL_INT, stride, (void*)offsetof(Batch2DVertexSpecification, entityId));
+        glEnableVertexAttribArray(4);
+        glBindVertexArray(0);
+    }
+
+    void Renderer2D::submit(const RendererSpecification& rendererSpec) {
+        auto& textureSpecifications = rendererSpec.texture->getAttachments().textureSpecifications;
+        uint32_t texture = textureSpecifications.empty() ? 0 : textureSpecifications.front().id;
+        float layer = rendererSpec.model[3].z;
+        items.emplace_back(&rendererSpec, layer, texture, isBatchable(rendererSpec));
+    }
+
+    void Renderer2D::render() {
+        drawCount = 0;
+        std::stable_sort(items.begin(), items.end(), [](const Batch2DItemSpecification& first, const Batch2DItemSpecification& second) {
+            if(first.layer != second.layer)
+                return first.layer > second.layer;
+            return first.texture < second.texture;
+        });
+        for(auto& item : items) {
+            if(!item.isBatched) {
+                flush();
+                Renderer::render2D(*item.rendererSpec);
+                ++drawCount;
+                continue;
+            }
+            if(!append(*item.rendererSpec, item.texture)) {
+                flush();
+                append(*item.rendererSpec, item.texture);
+            }
+        }
+        flush();
+        items.clear();
+    }
+
+    bool Renderer2D::append(const RendererSpecification& rendererSpec, uint32_t texture) {
+        auto& vboPtr = rendererSpec.vbo;
+        auto& eboPtr = rendererSpec.ebo;
+        int vertexCount = vboPtr->getVertexCount();
+        int indexCount = eboPtr->getCount();
+        if(vertices.size() + vertexCount > maxVertices || indices.size() + indexCount > maxIndices)
+            return false;
+        int textureSlot = -1;
+        if(texture) {
+            auto slot = std::find(textureSlots.begin(), textureSlots.end(), texture);
+            if(slot == textureSlots.end()) {
+                if(textureSlots.size() == maxTextureSlots)
+                    return false;
+                slot = textureSlots.insert(textureSlots.end(), texture);
+            }
+            textureSlot = static_cast<int>(slot - textureSlots.begin());
+            rendererSpec.texture->requestLevel();
+        }
+        auto& model = rendererSpec.model;
+        glm::vec4 color(rendererSpec.material.objColor, 1.f);
+        int entityId = rendererSpec.entityId;
+        uint32_t baseVertex = static_cast<uint32_t>(vertices.size());
+        const float* source = vboPtr->getVertices();
+        for(int i = 0; i < vertexCount; ++i, source += VertexLayout::sourceStride) {
+            glm::vec4 position = model * glm::vec4(source[0], source[1], source[2], 1.f);
+            vertices.push_back({ glm::vec3(position), { source[6], source[7] }, color, static_cast<float>(textureSlot), entityId });
+        }
+        if(eboPtr->getIndexType() == GL_UNSIGNED_SHORT) {
+            auto data = static_cast<const uint16_t*>(eboPtr->getData());
+            for(int i = 0; i < indexCount; ++i)
+                indices.push_back(baseVertex + data[i]);
+        }
+        else {
+            auto data = static_cast<const uint32_t*>(eboPtr->getData());
+            for(int i = 0; i < indexCount; ++i)
+                indices.push_back(baseVertex + data[i]);
+        }
+        return true;
+    }
+
+    void Renderer2D::flush() {
+        if(indices.empty()) {
+            vertices.clear();
+            textureSlots.clear();
+            return;
+        }
+        shader->use();
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, maxVertices * sizeof(Batch2DVertexSpecification), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(Batch2DVertexSpecification), vertices.data());
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, maxIndices * sizeof(uint32_t), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indices.size() * sizeof(uint32_t), indices.data());
+        for(size_t i = 0; i < textureSlots.size(); ++i) {
+            glActiveTexture(GL_TEXTURE0 + static_cast<GLenum>(i));
+            glBindTexture(GL_TEXTURE_2D, textureSlots[i]);
+        }
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, (void*)0);
+        glBindVertexArray(0);
+        ++drawCount;
+        vertices.clear();
+        indices.clear();
+        textureSlots.clear();
+    }
+
+    bool Renderer2D::isBatchable(const RendererSpecification& rendererSpec) {
+        auto& meshShader = rendererSpec.shader;
+        if(!shader || meshShader->getVertPath() != uiVertPath || meshShader->getFragPath() != uiFragPath)
+            return false;
+        if(rendererSpec.isModel)
+            return false;
+        auto& vboPtr = rendererSpec.vbo;
+        auto& eboPtr = rendererSpec.ebo;
+        return vboPtr && eboPtr && vboPtr->getLayout().isDefault() && vboPtr->getVertices() && eboPtr->getData()
+            && vboPtr->getVertexCount() <= maxMeshVertices;
+    }
+
+    int Renderer2D::getDrawCount() noexcept { return drawCount; }
+}
\ No newline at end of file
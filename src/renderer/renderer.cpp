@@ -1,7 +1,16 @@
 #include "renderer/renderer.hpp"
+#include "scene/shape.hpp"
+#include "renderer/renderer-2d.hpp"
+#include "renderer/deferred-renderer.hpp"
 
 namespace TWE {
     std::vector<LightShaderNamesSpecification> Renderer::lightShaderNames;
+    float Renderer::lodBias = 1.f;
+    int Renderer::viewportWidth = 1;
+    int Renderer::viewportHeight = 1;
+    const int Renderer::maxViews = 32;
+    const float Renderer::lodErrorThreshold = 0.002f;
+    const float Renderer::lodHysteresis = 0.2f;
 
     void Renderer::init(int lightShaderNamesSize) {
         lightShaderNames.clear();
@@ -27,60 +36,315 @@ namespace TWE {
     }
 
     void Renderer::render2D(const RendererSpecification& rendererSpec) {
-        auto& model = rendererSpec.transformComponent->getModel();
-        auto& texture = rendererSpec.meshComponent->getTexture();
-        auto& shader = rendererSpec.meshRendererComponent->getShader();
-        shader->setUniform("model", model);
-        shader->setUniform("hasTexture", !texture->getAttachments().textureSpecifications.empty());
-        rendererSpec.meshRendererComponent->updateMaterialUniform();
-        rendererSpec.meshComponent->getVAO()->bind();
-        texture->bind();
-        glDrawElements(GL_TRIANGLES, rendererSpec.meshComponent->getEBO()->getSize() / sizeof(int), GL_UNSIGNED_INT, (void*)0);
+        auto& shader = rendererSpec.shader;
+        shader->setUniform("model", rendererSpec.model);
+        shader->setUniform("hasTexture", !rendererSpec.texture->getAttachments().textureSpecifications.empty());
+        setMaterialUniform(*shader, rendererSpec.material);
+        setCustomUniforms(*shader, rendererSpec);
+        setVertexLayout(*shader, *rendererSpec.vbo);
+        rendererSpec.texture->requestLevel();
+        rendererSpec.texture->bind();
+        drawMesh(rendererSpec, rendererSpec.lodIndex);
     }
 
     void Renderer::render3D(const RendererSpecification& rendererSpec, const glm::vec3& cameraPosition, const glm::mat4& cameraView, const glm::mat4& cameraProjection, 
     const glm::mat4& cameraProjectionView, int lightsCount) {
-        auto& model = rendererSpec.transformComponent->getModel();
-        auto& shader = rendererSpec.meshRendererComponent->getShader();
-        auto texture = rendererSpec.meshComponent->getTexture();
-        rendererSpec.meshRendererComponent->updateMatsUniform(model, cameraView, cameraProjection, cameraProjectionView);
+        auto& shader = rendererSpec.shader;
+        int lodIndex = selectLOD(rendererSpec.lodChain.get(), rendererSpec.lodIndex, rendererSpec.model, cameraPosition, cameraProjection);
+        requestTextureLevels(rendererSpec, cameraPosition, cameraProjection);
+        setMatsUniform(*shader, rendererSpec.model, cameraView, cameraProjection, cameraProjectionView);
         shader->setUniform("viewPos", cameraPosition);
-        shader->setUniform("hasTexture", !texture->getAttachments().textureSpecifications.empty());
+        shader->setUniform("hasTexture", !rendererSpec.texture->getAttachments().textureSpecifications.empty());
         shader->setUniform("lightCount", lightsCount);
         shader->setUniform("calculateLight", true);
-        rendererSpec.meshRendererComponent->updateMaterialUniform();
-        rendererSpec.meshComponent->getVAO()->bind();
-        texture->bind();
-        glDrawElements(GL_TRIANGLES, rendererSpec.meshComponent->getEBO()->getSize() / sizeof(int), GL_UNSIGNED_INT, (void*)0);
+        setMaterialUniform(*shader, rendererSpec.material);
+        setCustomUniforms(*shader, rendererSpec);
+        setVertexLayout(*shader, *rendererSpec.vbo);
+        rendererSpec.texture->bind();
+        drawMesh(rendererSpec, lodIndex);
+    }
+
+    void Renderer::setVertexLayout(Shader& shader, VBO& vbo) {
+        auto& dequantization = vbo.getLayout().getDequantization();
+        shader.setUniform("posScale", dequantization.positionScale);
+        shader.setUniform("posOffset", dequantization.positionOffset);
+    }
+
+    void Renderer::setMatsUniform(Shader& shader, const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection, const glm::mat4& projectionView) {
+        shader.setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::MODEL], model);
+        shader.setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::VIEW], view);
+        shader.setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::PROJECTION], projection);
+        shader.setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::MVP], projectionView * model);
+    }
+
+    void Renderer::setMaterialUniform(Shader& shader, const Material& material) {
+        shader.setUniform("material.objColor", material.objColor);
+        shader.setUniform("material.ambient", material.ambient);
+        shader.setUniform("material.diffuse", material.diffuse);
+        shader.setUniform("material.specular", material.specular);
+        shader.setUniform("material.shininess", material.shininess);
+    }
+
+    void Renderer::setCustomUniforms(Shader& shader, const RendererSpecification& rendererSpec) {
+        if(!rendererSpec.uniforms)
+            return;
+        for(auto& uniform : *rendererSpec.uniforms)
+            shader.setUniform(uniform);
+    }
+
+    void Renderer::drawMesh(const RendererSpecification& rendererSpec, int lodIndex) {
+        if(!rendererSpec.vbo->getIsUploaded())
+            return;
+        auto& submesh = rendererSpec.submesh;
+        auto& lodChain = rendererSpec.lodChain;
+        if(lodChain && lodIndex > 0 && lodIndex < lodChain->lods.size() && lodChain->lods[lodIndex].ebo->getIsUploaded()) {
+            auto& lod = lodChain->lods[lodIndex];
+            lod.vao->bind();
+            glDrawElementsBaseVertex(GL_TRIANGLES, lod.ebo->getCount(), lod.ebo->getIndexType(), (void*)0, submesh.baseVertex);
+            return;
+        }
+        auto& ebo = rendererSpec.ebo;
+        if(!ebo->getIsUploaded())
+            return;
+        rendererSpec.vao->bind();
+        if(submesh.isValid())
+            glDrawElementsBaseVertex(GL_TRIANGLES, submesh.indexCount, ebo->getIndexType(), 
+                (void*)(static_cast<uintptr_t>(submesh.indexOffset) * ebo->getIndexSize()), submesh.baseVertex);
+        else
+            glDrawElements(GL_TRIANGLES, ebo->getCount(), ebo->getIndexType(), (void*)0);
+    }
+
+    int Renderer::selectLOD(const MeshLODChainSpecification* lodChain, int lodIndex, const glm::mat4& model, const glm::vec3& cameraPosition, 
+    const glm::mat4& cameraProjection) {
+        if(!lodChain || lodChain->lods.size() < 2)
+            return lodIndex;
+        glm::vec3 center = model * glm::vec4(lodChain->center, 1.f);
+        float scale = glm::max(glm::length(glm::vec3(model[0])), glm::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+        float radius = lodChain->radius * scale;
+        float screenSize = radius * cameraProjection[1][1];
+        if(cameraProjection[2][3] != 0.f)
+            screenSize /= glm::max(glm::length(center - cameraPosition) - radius, 0.0001f);
+        int lodCount = static_cast<int>(lodChain->lods.size());
+        lodIndex = glm::min(lodIndex, lodCount - 1);
+        auto isAcceptable = [&](int index, float factor) {
+            return lodChain->lods[index].error * screenSize <= lodErrorThreshold * lodBias * factor;
+        };
+        while(lodIndex + 1 < lodCount && isAcceptable(lodIndex + 1, 1.f - lodHysteresis))
+            ++lodIndex;
+        while(lodIndex > 0 && !isAcceptable(lodIndex, 1.f + lodHysteresis))
+            --lodIndex;
+        return lodIndex;
+    }
+
+    void Renderer::requestTextureLevels(const RendererSpecification& rendererSpec, const glm::vec3& cameraPosition, const glm::mat4& cameraProjection) {
+        auto& texture = rendererSpec.texture;
+        if(texture->getAttachments().textureSpecifications.empty())
+            return;
+        auto& lodChain = rendererSpec.lodChain;
+        auto& model = rendererSpec.model;
+        glm::vec3 center = model * glm::vec4(lodChain ? lodChain->center : glm::vec3(0.f), 1.f);
+        float scale = glm::max(glm::length(glm::vec3(model[0])), glm::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+        float radius = (lodChain ? lodChain->radius : 1.f) * scale;
+        float screenSize = radius * cameraProjection[1][1] * viewportHeight;
+        if(cameraProjection[2][3] != 0.f)
+            screenSize /= glm::max(glm::length(center - cameraPosition) - radius, 0.0001f);
+        texture->requestLevel(screenSize);
+    }
+
+    void Renderer::setLODBias(float lodBias) {
+        Renderer::lodBias = glm::max(lodBias, 0.f);
+    }
+
+    float Renderer::getLODBias() noexcept { return lodBias; }
+
+    FrustumSpecification Renderer::createFrustum(const glm::mat4& projectionView) {
+        FrustumSpecification frustum;
+        glm::vec4 rows[4];
+        for(int i = 0; i < 4; ++i)
+            rows[i] = { projectionView[0][i], projectionView[1][i], projectionView[2][i], projectionView[3][i] };
+        for(int i = 0; i < 3; ++i) {
+            frustum.planes[i * 2] = rows[3] + rows[i];
+            frustum.planes[i * 2 + 1] = rows[3] - rows[i];
+        }
+        for(auto& plane : frustum.planes)
+            plane /= glm::max(glm::length(glm::vec3(plane)), 0.0001f);
+        return frustum;
+    }
+
+    bool Renderer::isVisible(const FrustumSpecification& frustum, const glm::vec3& center, float radius) {
+        for(auto& plane : frustum.planes)
+            if(glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+                return false;
+        return true;
+    }
+
+    bool Renderer::getBoundingSphere(const MeshLODChainSpecification* lodChain, const glm::mat4& model, glm::vec3& center, float& radius) {
+        if(!lodChain)
+            return false;
+        center = model * glm::vec4(lodChain->center, 1.f);
+        float scale = glm::max(glm::length(glm::vec3(model[0])), glm::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+        radius = lodChain->radius * scale;
+        return true;
+    }
+
+    void Renderer::resolveLODChain(MeshComponent& meshComponent) {
+        if(meshComponent.getIsLODChainResolved())
+            return;
+        auto meshSpecification = Shape::shapeSpec->meshRegistry->get(meshComponent.getRegistryId());
+        meshComponent.setLODChain(meshSpecification ? meshSpecification->lodChain : nullptr);
     }
 
     void Renderer::renderScene(IScene* scene) {
-        SceneCameraSpecification* camera = scene->getSceneCamera();
-        if(!camera->camera)
+        auto sceneViews = scene->getSceneViews();
+        if(!sceneViews || sceneViews->empty())
             return;
-        int lightsCount = scene->getLightsCount();
+        static std::vector<RenderItemSpecification> draws;
+        static std::vector<RenderLightSpecification> lights;
         bool isFocusedOnDebugCamera = scene->getIsFocusedOnDebugCamera();
-        static std::vector<RendererSpecification> _2DEntities;
-        scene->getRegistry()->view<MeshComponent, MeshRendererComponent, TransformComponent>()
+        collectScene(scene, *sceneViews, isFocusedOnDebugCamera, draws, lights);
+        renderViews(*sceneViews, draws, lights, isFocusedOnDebugCamera);
+        #ifndef TWE_BUILD
+        if(isFocusedOnDebugCamera) {
+            auto camera = scene->getSceneCamera();
+            scene->getSceneStateSpecification()->physics->getDebugDrawer()->setMats(camera->view, camera->projection);
+            scene->getSceneStateSpecification()->physics->debugDrawWorld();
+        }
+        #endif
+        draws.clear();
+        lights.clear();
+    }
+
+    void Renderer::captureScene(IScene* scene, RenderSnapshotSpecification& snapshot) {
+        clearSnapshot(snapshot);
+        snapshot.isFocusedOnDebugCamera = scene->getIsFocusedOnDebugCamera();
+        auto sceneViews = scene->getSceneViews();
+        if(!sceneViews || sceneViews->empty())
+            return;
+        int viewCount = std::min(static_cast<int>(sceneViews->size()), maxViews);
+        snapshot.views.assign(sceneViews->begin(), sceneViews->begin() + viewCount);
+        collectScene(scene, snapshot.views, snapshot.isFocusedOnDebugCamera, snapshot.draws, snapshot.lights);
+    }
+
+    void Renderer::collectScene(IScene* scene, const std::vector<SceneViewSpecification>& views, bool isFocusedOnDebugCamera, 
+    std::vector<RenderItemSpecification>& draws, std::vector<RenderLightSpecification>& lights) {
+        int viewCount = std::min(static_cast<int>(views.size()), maxViews);
+        static std::vector<FrustumSpecification> frustums;
+        frustums.clear();
+        for(int i = 0; i < viewCount; ++i)
+            frustums.push_back(createFrustum(views[i].camera.projectionView));
+        bool hasShadows = false;
+        auto registry = scene->getRegistry();
+        registry->view<LightComponent, TransformComponent>()
+            .each([&](entt::entity entity, LightComponent& lightComponent, TransformComponent& transformComponent){
+                lights.emplace_back(lightComponent, transformComponent);
+                hasShadows |= lightComponent.getCastShadows();
+            });
+        registry->view<MeshComponent, MeshRendererComponent, TransformComponent>()
             .each([&](entt::entity entity, MeshComponent& meshComponent, MeshRendererComponent& meshRendererComponent, TransformComponent& transformComponent){
                 if(!meshRendererComponent.getIs3D()) {
                     if(!isFocusedOnDebugCamera)
-                        _2DEntities.push_back({&meshComponent, &meshRendererComponent, &transformComponent});
+                        draws.emplace_back(RendererSpecification(meshComponent, meshRendererComponent, transformComponent), 0u);
                     return;
                 }
-                render3D({&meshComponent, &meshRendererComponent, &transformComponent}, camera->position, camera->view, camera->projection, camera->projectionView, lightsCount);
+                resolveLODChain(meshComponent);
+                auto lodChain = meshComponent.getLODChain().get();
+                glm::mat4 model = transformComponent.getModel();
+                glm::vec3 center;
+                float radius;
+                bool hasBounds = getBoundingSphere(lodChain, model, center, radius);
+                uint32_t viewMask = 0;
+                for(int i = viewCount - 1; i >= 0; --i) {
+                    if(hasBounds && !isVisible(frustums[i], center, radius))
+                        continue;
+                    if(!viewMask)
+                        meshComponent.setLODIndex(selectLOD(lodChain, meshComponent.getLODIndex(), model, views[i].camera.position, views[i].camera.projection));
+                    viewMask |= 1u << i;
+                }
+                if(viewMask || hasShadows)
+                    draws.emplace_back(RendererSpecification(meshComponent, meshRendererComponent, transformComponent), viewMask);
             });
-        if(isFocusedOnDebugCamera) {
-            #ifndef TWE_BUILD
-            scene->getSceneStateSpecification()->physics->getDebugDrawer()->setMats(camera->view, camera->projection);
-            scene->getSceneStateSpecification()->physics->debugDrawWorld();
-            #endif
+    }
+
+    void Renderer::renderSnapshot(RenderSnapshotSpecification& snapshot) {
+        renderViews(snapshot.views, snapshot.draws, snapshot.lights, snapshot.isFocusedOnDebugCamera);
+    }
+
+    void Renderer::renderViews(const std::vector<SceneViewSpecification>& views, const std::vector<RenderItemSpecification>& draws, 
+    std::vector<RenderLightSpecification>& lights, bool isFocusedOnDebugCamera) {
+        if(views.empty())
             return;
+        int lightsCount = static_cast<int>(lights.size());
+        int viewCount = std::min(static_cast<int>(views.size()), maxViews);
+        renderLights(draws, lights);
+        for(auto& draw : draws)
+            if(!draw.rendererSpec.is3D)
+                Renderer2D::submit(draw.rendererSpec);
+        int width = viewportWidth;
+        int height = viewportHeight;
+        int framebuffer = 0;
+        if(views[0].renderTarget)
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+        for(int i = 0; i < viewCount; ++i) {
+            auto& sceneView = views[i];
+            glm::vec4 viewport;
+            if(sceneView.renderTarget) {
+                sceneView.renderTarget->bind();
+                cleanScreen({0.f, 0.f, 0.f, 1.f});
+                viewport = { 0.f, 0.f, sceneView.renderTarget->getSize().width, sceneView.renderTarget->getSize().height };
+            } else
+                viewport = glm::floor(sceneView.viewport * glm::vec4(width, height, width, height));
+            setViewport(static_cast<int>(viewport.x), static_cast<int>(viewport.y), static_cast<int>(viewport.z), static_cast<int>(viewport.w));
+            if(sceneView.renderPath == RenderPath::Deferred)
+                DeferredRenderer::render(lights, sceneView, draws, 1u << i, viewport, lightsCount);
+            else
+                renderView(sceneView, draws, i, lightsCount);
+            if(sceneView.renderTarget)
+                glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
         }
+        setViewport(0, 0, width, height);
+        if(isFocusedOnDebugCamera)
+            return;
         cleanDepth();
-        for(auto& rendererSpec : _2DEntities)
-            render2D(rendererSpec);
-        _2DEntities.clear();
+        Renderer2D::render();
+    }
+
+    void Renderer::clearSnapshot(RenderSnapshotSpecification& snapshot) {
+        snapshot.views.clear();
+        snapshot.draws.clear();
+        snapshot.lights.clear();
+    }
+
+    void Renderer::renderLights(const std::vector<RenderItemSpecification>& draws, std::vector<RenderLightSpecification>& lights) {
+        int framebuffer = 0;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &framebuffer);
+        int width = viewportWidth;
+        int height = viewportHeight;
+        for(int i = 0; i < static_cast<int>(lights.size()); ++i) {
+            auto& light = lights[i];
+            bool castShadows = light.lightComponent.getCastShadows();
+            glm::mat4 lightSpaceMat(1.f);
+            if(castShadows) {
+                glm::mat4 lightProjection = light.lightComponent.getLightProjection();
+                glm::mat4 lightView = glm::lookAt(light.position, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f});
+                lightSpaceMat = lightProjection * lightView;
+                generateDepthMap(light.lightComponent, light.position, lightProjection, lightView, lightSpaceMat, draws);
+            }
+            for(auto& draw : draws) {
+                setLight(*draw.rendererSpec.shader, light, i);
+                if(castShadows)
+                    setShadows(*draw.rendererSpec.shader, lightSpaceMat, i);
+            }
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        setViewport(0, 0, width, height);
+    }
+
+    void Renderer::renderView(const SceneViewSpecification& sceneView, const std::vector<RenderItemSpecification>& draws, int viewIndex, int lightsCount) {
+        auto& camera = sceneView.camera;
+        uint32_t viewBit = 1u << viewIndex;
+        for(auto& draw : draws)
+            if(draw.viewMask & viewBit)
+                render3D(draw.rendererSpec, camera.position, camera.view, camera.projection, camera.projectionView, lightsCount);
     }
 
     void Renderer::cleanScreen(const glm::vec4& color) {
@@ -96,36 +360,37 @@ namespace TWE {
 
     void Renderer::setViewport(int startX, int startY, int endX, int endY) {
         glViewport(startX, startY, endX, endY);
+        viewportWidth = endX;
+        viewportHeight = endY;
     }
 
-    void Renderer::setLight(MeshRendererComponent& meshRendererComponent, const LightComponent& light, TransformComponent& transform, int lightIndex) {
+    void Renderer::setLight(Shader& shader, const RenderLightSpecification& light, int lightIndex) {
         if(lightShaderNames.size() <= lightIndex)
             return;
-        auto& shader = meshRendererComponent.getShader();
-        shader->setUniform(lightShaderNames[lightIndex].pos.c_str(), transform.getPosition());
-        shader->setUniform(lightShaderNames[lightIndex].direction.c_str(), transform.getForward());
-        shader->setUniform(lightShaderNames[lightIndex].color.c_str(), light.getColor());
-        shader->setUniform(lightShaderNames[lightIndex].cutOff.c_str(), glm::cos(glm::radians(light.getInnerRadius())));
-        shader->setUniform(lightShaderNames[lightIndex].outerCutOff.c_str(), glm::cos(glm::radians(light.getOuterRadius())));
-        shader->setUniform(lightShaderNames[lightIndex].castShadows.c_str(), light.getCastShadows());
-        shader->setUniform(lightShaderNames[lightIndex].fadingConstant.c_str(), light.getConstant());
-        shader->setUniform(lightShaderNames[lightIndex].fadingLinear.c_str(), light.getLinear());
-        shader->setUniform(lightShaderNames[lightIndex].fadingQuadratic.c_str(), light.getQuadratic());
-        shader->setUniform(lightShaderNames[lightIndex].typeDir.c_str(), light.getType() == LightType::Dir);
-        shader->setUniform(lightShaderNames[lightIndex].typePoint.c_str(), light.getType() == LightType::Point);
-        shader->setUniform(lightShaderNames[lightIndex].typeSpot.c_str(), light.getType() == LightType::Spot);
-    }
-
-    void Renderer::setShadows(MeshRendererComponent& meshRendererComponent, const glm::mat4& lightSpaceMat, int lightIndex) {
+        auto& lightComponent = light.lightComponent;
+        shader.setUniform(lightShaderNames[lightIndex].pos.c_str(), light.position);
+        shader.setUniform(lightShaderNames[lightIndex].direction.c_str(), light.forward);
+        shader.setUniform(lightShaderNames[lightIndex].color.c_str(), lightComponent.getColor());
+        shader.setUniform(lightShaderNames[lightIndex].cutOff.c_str(), glm::cos(glm::radians(lightComponent.getInnerRadius())));
+        shader.setUniform(lightShaderNames[lightIndex].outerCutOff.c_str(), glm::cos(glm::radians(lightComponent.getOuterRadius())));
+        shader.setUniform(lightShaderNames[lightIndex].castShadows.c_str(), lightComponent.getCastShadows());
+        shader.setUniform(lightShaderNames[lightIndex].fadingConstant.c_str(), lightComponent.getConstant());
+        shader.setUniform(lightShaderNames[lightIndex].fadingLinear.c_str(), lightComponent.getLinear());
+        shader.setUniform(lightShaderNames[lightIndex].fadingQuadratic.c_str(), lightComponent.getQuadratic());
+        shader.setUniform(lightShaderNames[lightIndex].typeDir.c_str(), lightComponent.getType() == LightType::Dir);
+        shader.setUniform(lightShaderNames[lightIndex].typePoint.c_str(), lightComponent.getType() == LightType::Point);
+        shader.setUniform(lightShaderNames[lightIndex].typeSpot.c_str(), lightComponent.getType() == LightType::Spot);
+    }
+
+    void Renderer::setShadows(Shader& shader, const glm::mat4& lightSpaceMat, int lightIndex) {
         if(lightShaderNames.size() <= lightIndex)
             return;
-        auto& shader = meshRendererComponent.getShader();
-        shader->setUniform(lightShaderNames[lightIndex].lightSpaceMat.c_str(), lightSpaceMat);
-        shader->setUniform(lightShaderNames[lightIndex].shadowMap.c_str(), 31);
+        shader.setUniform(lightShaderNames[lightIndex].lightSpaceMat.c_str(), lightSpaceMat);
+        shader.setUniform(lightShaderNames[lightIndex].shadowMap.c_str(), 31);
     }
 
-    void Renderer::generateDepthMap(LightComponent& lightComponent, const TransformComponent& transformComponent, const glm::mat4& lightProjection, 
-    const glm::mat4& lightView, const glm::mat4& projectionView, IScene* scene) {
+    void Renderer::generateDepthMap(LightComponent& lightComponent, const glm::vec3& position, const glm::mat4& lightProjection, 
+    const glm::mat4& lightView, const glm::mat4& projectionView, const std::vector<RenderItemSpecification>& draws) {
         auto fbo = lightComponent.getFBO();
         auto& depthMapSize = fbo->getSize();
         glActiveTexture(GL_TEXTURE31);
@@ -134,24 +399,25 @@ namespace TWE {
         glCullFace(GL_FRONT);
         fbo->bind();
         glClear(GL_DEPTH_BUFFER_BIT);
-        renderShadowMap(scene, transformComponent.getPosition(), lightView, lightProjection, projectionView);
+        renderShadowMap(draws, position, lightView, lightProjection, projectionView);
         fbo->unbind();
         glCullFace(GL_BACK);
     }
 
-    void Renderer::renderShadowMap(IScene* scene, const glm::vec3& position, const glm::mat4& view, const glm::mat4& projection, const glm::mat4& projectionView) {
-        scene->getRegistry()->view<MeshComponent, MeshRendererComponent, TransformComponent>()
-            .each([&](entt::entity entity, MeshComponent& meshComponent, MeshRendererComponent& meshRendererComponent, TransformComponent& transformComponent){
-                if(!meshRendererComponent.getIs3D())
-                    return;
-                auto& model = transformComponent.getModel();
-                auto& shader = meshRendererComponent.getShader();
-                shader->use();
-                meshRendererComponent.updateMatsUniform(model, view, projection, projectionView);
-                shader->setUniform("viewPos", position);
-                shader->setUniform("calculateLight", false);
-                meshComponent.getVAO()->bind();
-                glDrawElements(GL_TRIANGLES, meshComponent.getEBO()->getSize() / sizeof(int), GL_UNSIGNED_INT, (void*)0);
-            });
+    void Renderer::renderShadowMap(const std::vector<RenderItemSpecification>& draws, const glm::vec3& position, const glm::mat4& view, const glm::mat4& projection, 
+    const glm::mat4& projectionView) {
+        for(auto& draw : draws) {
+            auto& rendererSpec = draw.rendererSpec;
+            if(!rendererSpec.is3D)
+                continue;
+            auto& shader = rendererSpec.shader;
+            shader->use();
+            setMatsUniform(*shader, rendererSpec.model, view, projection, projectionView);
+            shader->setUniform("viewPos", position);
+            shader->setUniform("calculateLight", false);
+            setCustomUniforms(*shader, rendererSpec);
+            setVertexLayout(*shader, *rendererSpec.vbo);
+            drawMesh(rendererSpec, rendererSpec.lodIndex);
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include "renderer/shader-cache.hpp"
+#include "renderer/shader.hpp"
+
+namespace TWE {
+    const std::string ShaderCache::extension = ".twebin";
+    const uint32_t ShaderCache::magic = 0x53455754;
+    const uint32_t ShaderCache::version = 1;
+    std::map<std::string, ShaderBinarySpecification>* ShaderCache::binaries = new std::map<std::string, ShaderBinarySpecification>();
+    #ifndef TWE_BUILD
+    std::map<std::filesystem::path, std::string>* ShaderCache::watchedFiles = new std::map<std::filesystem::path, std::string>();
+    std::map<std::filesystem::path, std::unique_ptr<FileWatcher>>* ShaderCache::watchers = new std::map<std::filesystem::path, std::unique_ptr<FileWatcher>>();
+    #endif
+
+    uint32_t ShaderCache::createProgram(const std::string& vertPath, const std::string& fragPath, const std::vector<std::string>& defines) {
+        #ifndef TWE_BUILD
+        watch(vertPath);
+        watch(fragPath);
+        #endif
+        std::string binaryId = getBinaryId(vertPath, fragPath, defines);
+        auto binaryIt = binaries->find(binaryId);
+        if(binaryIt != binaries->end()) {
+            uint32_t program = loadBinary(binaryIt->second);
+            if(program)
+                return program;
+            binaries->erase(binaryIt);
+        }
+        std::string vertBody = applyDefines(File::getBody(vertPath.c_str()), defines);
+        std::string fragBody = applyDefines(File::getBody(fragPath.c_str()), defines);
+        if(!isBinarySupported())
+            return compileProgram(vertBody, fragBody);
+        uint64_t key = calculateKey(vertBody, fragBody, defines);
+        auto cachePath = getCachePath(vertPath, fragPath, defines);
+        ShaderBinarySpecification binary(vertPath, fragPath, 0, {});
+        if(readBinary(cachePath, key, binary)) {
+            uint32_t program = loadBinary(binary);
+            if(program) {
+                (*binaries)[binaryId] = std::move(binary);
+                return program;
+            }
+        }
+        uint32_t program = compileProgram(vertBody, fragBody);
+        if(!program)
+            return 0;
+        int binarySize = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+        if(binarySize <= 0)
+            return program;
+        binary.data.resize(binarySize);
+        GLenum format = 0;
+        glGetProgramBinary(program, binarySize, nullptr, &format, binary.data.data());
+        binary.format = format;
+        writeBinary(cachePath, key, binary);
+        (*binaries)[binaryId] = std::move(binary);
+        return program;
+    }
+
+    #ifndef TWE_BUILD
+    void ShaderCache::update() {
+        std::set<std::string> changedPaths;
+        for(auto& [directory, watcher] : *watchers) {
+            for(auto& event : watcher->poll()) {
+                if(event.type == FileWatchEventType::Removed)
+                    continue;
+                if(event.type == FileWatchEventType::Rescan) {
+                    for(auto& [absolutePath, path] : *watchedFiles)
+                        if(absolutePath.parent_path() == directory)
+                            changedPaths.insert(path);
+                    continue;
+                }
+                auto watchedFile = watchedFiles->find(event.path.lexically_normal());
+                if(watchedFile != watchedFiles->end())
+                    changedPaths.insert(watchedFile->second);
+            }
+        }
+        for(auto& path : changedPaths) {
+            for(auto binaryIt = binaries->begin(); binaryIt != binaries->end();) {
+                if(binaryIt->second.vertPath == path || binaryIt->second.fragPath == path)
+                    binaryIt = binaries->erase(binaryIt);
+                else
+                    ++binaryIt;
+            }
+            Shader::reload(path);
+        }
+    }
+    #endif
+
+    void ShaderCache::clear() {
+        binaries->clear();
+        #ifndef TWE_BUILD
+        watchedFiles->clear();
+        watchers->clear();
+        #endif
+    }
+
+    uint32_t ShaderCache::compileProgram(const std::string& vertBody, const std::string& fragBody) {
+        uint32_t vertexShader = compileShader(vertBody.c_str(), GL_VERTEX_SHADER);
+        uint32_t fragmentShader = compileShader(fragBody.c_str(), GL_FRAGMENT_SHADER);
+        if(!vertexShader || !fragmentShader) {
+            glDeleteShader(vertexShader);
+            glDeleteShader(fragmentShader);
+            return 0;
+        }
+        uint32_t program = glCreateProgram();
+        if(isBinarySupported())
+            glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        glLinkProgram(program);
+        glDetachShader(program, vertexShader);
+        glDetachShader(program, fragmentShader);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+        int status;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if(!status) {
+            char errorInfo[512];
+            glGetProgramInfoLog(program, sizeof(errorInfo), NULL, errorInfo);
+            std::cout << "Error link the shaders.\n" << errorInfo << std::endl;
+            glDeleteProgram(program);
+            return 0;
+        }
+        return program;
+    }
+
+    uint32_t ShaderCache::compileShader(const char* body, uint32_t shaderType) {
+        uint32_t shader = glCreateShader(shaderType);
+        glShaderSource(shader, 1, &body, nullptr);
+        glCompileShader(shader);
+        int status;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+        if(!status) {
+            char errorInfo[512];
+            glGetShaderInfoLog(shader, sizeof(errorInfo), NULL, errorInfo);
+            std::cout << "Error compilation a shader.\n" << errorInfo << std::endl;
+            glDeleteShader(shader);
+            return 0;
+        }
+        return shader;
+    }
+
+    uint32_t ShaderCache::loadBinary(const ShaderBinarySpecification& binary) {
+        if(binary.data.empty())
+            return 0;
+        uint32_t program = glCreateProgram();
+        glProgramBinary(program, binary.format, binary.data.data(), static_cast<GLsizei>(binary.data.size()));
+        int status;
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if(!status) {
+            glDeleteProgram(program);
+            return 0;
+        }
+        return program;
+    }
+
+    bool ShaderCache::readBinary(const std::filesystem::path& cachePath, uint64_t key, ShaderBinarySpecification& binary) {
+        std::ifstream is(cachePath, std::ios::binary);
+        if(!is.is_open())
+            return false;
+        ShaderCacheHeaderSpecification header;
+        if(!is.read(reinterpret_cast<char*>(&header), sizeof(header)))
+            return false;
+        if(header.magic != magic || header.version != version || header.key != key || header.size == 0)
+            return false;
+        binary.format = header.format;
+        binary.data.resize(header.size);
+        return static_cast<bool>(is.read(reinterpret_cast<char*>(binary.data.data()), header.size));
+    }
+
+    void ShaderCache::writeBinary(const std::filesystem::path& cachePath, uint64_t key, const ShaderBinarySpecification& binary) {
+        std::ofstream os(cachePath, std::ios::binary | std::ios::trunc);
+        if(!os.is_open()) {
+            std::cout << "Failed to write shader cache \"" << cachePath.string() << "\"" << std::endl;
+            return;
+        }
+        ShaderCacheHeaderSpecification header;
+        header.magic = magic;
+        header.version = version;
+        header.key = key;
+        header.format = binary.format;
+        header.size = static_cast<uint32_t>(binary.data.size());
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os.write(reinterpret_cast<const char*>(binary.data.data()), binary.data.size());
+    }
+
+    #ifndef TWE_BUILD
+    void ShaderCache::watch(const std::string& path) {
+        auto absolutePath = getAbsolutePath(path);
+        if(!watchedFiles->emplace(absolutePath, path).second)
+            return;
+        auto directory = absolutePath.parent_path();
+        if(watchers->find(directory) != watchers->end())
+            return;
+        auto watcher = std::make_unique<FileWatcher>();
+        if(watcher->watch(directory))
+            (*watchers)[directory] = std::move(watcher);
+    }
+    #endif
+
+    std::string ShaderCache::applyDefines(const std::string& body, const std::vector<std::string>& defines) {
+        if(defines.empty())
+            return body;
+        std::string defineLines;
+        for(auto& define : defines)
+            defineLines += "#define " + define + "\n";
+        size_t insertPosition = 0;
+        if(body.compare(0, 8, "#version") == 0) {
+            insertPosition = body.find('\n');
+            insertPosition = insertPosition == std::string::npos ? body.size() : insertPosition + 1;
+        }
+        std::string result = body;
+        result.insert(insertPosition, defineLines);
+        return result;
+    }
+
+    std::filesystem::path ShaderCache::getCachePath(const std::string& vertPath, const std::string& fragPath, const std::vector<std::string>& defines) {
+        std::string key = getAbsolutePath(vertPath).string() + "|" + getAbsolutePath(fragPath).string();
+        for(auto& define : defines)
+            key += "|" + define;
+        return CacheDirectory::getFilePath("shaders", key, extension);
+    }
+
+    uint64_t ShaderCache::calculateKey(const std::string& vertBody, const std::string& fragBody, const std::vector<std::string>& defines) {
+        uint64_t hash = hashBytes(vertBody.data(), vertBody.size(), 14695981039346656037ull);
+        hash = hashBytes(fragBody.data(), fragBody.size(), hash);
+        for(auto& define : defines)
+            hash = hashBytes(define.data(), define.size() + 1, hash);
+        for(GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+            auto driverString = reinterpret_cast<const char*>(glGetString(name));
+            if(driverString)
+                hash = hashBytes(driverString, std::strlen(driverString), hash);
+        }
+        return hash;
+    }
+
+    bool ShaderCache::isBinarySupported() {
+        static int isSupported = -1;
+        if(isSupported < 0) {
+            int formatCount = 0;
+            if(glGetProgramBinary && glProgramBinary && glProgramParameteri)
+                glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+            isSupported = formatCount > 0;
+        }
+        return isSupported;
+    }
+
+    std::filesystem::path ShaderCache::getAbsolutePath(const std::string& path) {
+        std::error_code error;
+        auto absolutePath = std::filesystem::absolute(path, error).lexically_normal();
+        return error ? std::filesystem::path(path).lexically_normal() : absolutePath;
+    }
+
+    std::string ShaderCache::getBinaryId(const std::string& vertPath, const std::string& fragPath, const std::vector<std::string>& defines) {
+        std::string binaryId = vertPath + "|" + fragPath;
+        for(auto& define : defines)
+            binaryId += "|" + define;
+        return binaryId;
+    }
+
+    uint64_t ShaderCache::hashBytes(const void* data, size_t size, uint64_t hash) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for(size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+}
\ No newline at end of file
@@ -2,62 +2,137 @@
 
 namespace TWE {
     uint32_t Shader::currentShaderInUseID = UINT32_MAX;
-
-    Shader::Shader(const char* vertPath, const char* fragPath)
-    : _vertPath(vertPath), _fragPath(fragPath) {
-        std::string vertBody = File::getBody(vertPath);
-        std::string fragBody = File::getBody(fragPath);
-        const char* vertex = vertBody.c_str();
-        const char* fragment = fragBody.c_str();
-        uint32_t vertexShader = create(vertex, GL_VERTEX_SHADER);
-        uint32_t fragmentShader = create(fragment, GL_FRAGMENT_SHADER);
-        _id = glCreateProgram();
-        uint32_t shaders[2] = {
-            vertexShader,
-            fragmentShader
-        };
-        linkShaders(shaders, 2);
-        glDeleteShader(vertexShader);
-        glDeleteShader(fragmentShader);
+    #ifndef TWE_BUILD
+    std::set<Shader*>* Shader::shaders = new std::set<Shader*>();
+    std::mutex* Shader::shadersMutex = new std::mutex();
+    #endif
+
+    Shader::Shader(const char* vertPath, const char* fragPath, const std::vector<std::string>& defines)
+    : _vertPath(vertPath), _fragPath(fragPath), _defines(defines) {
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        JobSystem::runOnMainThread([this]() { _id = ShaderCache::createProgram(_vertPath, _fragPath, _defines); });
+        #else
+        _id = ShaderCache::createProgram(_vertPath, _fragPath, _defines);
+        #endif
+        #ifndef TWE_BUILD
+        std::lock_guard<std::mutex> lock(*shadersMutex);
+        shaders->insert(this);
+        #endif
     }
 
     Shader::Shader(const Shader& shader) {
         this->_id = shader._id;
         this->_vertPath = shader._vertPath;
         this->_fragPath = shader._fragPath;
+        this->_defines = shader._defines;
+        #ifndef TWE_BUILD
+        std::lock_guard<std::mutex> lock(*shadersMutex);
+        shaders->insert(this);
+        #endif
     }
 
     Shader::~Shader() {
-        clean();
-    }
-
-    uint32_t Shader::create(const char* fileContent, uint32_t shaderType) {
-        uint32_t shader = glCreateShader(shaderType);
-        glShaderSource(shader, 1, &fileContent, nullptr);
-        glCompileShader(shader);
-        int status;
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
-        if(!status) {
-            char errorInfo[512];
-            glGetShaderInfoLog(shader, sizeof(errorInfo), NULL, errorInfo);
-            // std::cout << "Error compilation a shader.\n" << errorInfo << std::endl;
-        };
-        return shader;
-    }
-
-    void Shader::linkShaders(uint32_t* shaders, uint32_t size) {
-        for(int i = 0; i < size; ++i)
-            glAttachShader(_id, shaders[i]);
-        glLinkProgram(_id);
-        int status;
-        glGetProgramiv(_id, GL_COMPILE_STATUS, &status);
-        if(!status) {
-            char errorInfo[512];
-            glGetProgramInfoLog(_id, sizeof(errorInfo), NULL, errorInfo);
-            // std::cout << "Error link the shaders.\n" << errorInfo << std::endl;
-        };
+        #ifndef TWE_BUILD
+        {
+            std::lock_guard<std::mutex> lock(*shadersMutex);
+            shaders->erase(this);
+        }
+        #endif
+        if(JobSystem::isMainThread()) {
+            clean();
+            return;
+        }
+        uint32_t id = _id;
+        JobSystem::submit([id]() { glDeleteProgram(id); }, {}, JobAffinity::MainThread);
+    }
+
+    #ifndef TWE_BUILD
+    void Shader::reload(const std::string& path) {
+        std::map<uint32_t, uint32_t> reloadedPrograms;
+        std::lock_guard<std::mutex> lock(*shadersMutex);
+        for(auto shader : *shaders) {
+            if(shader->_vertPath != path && shader->_fragPath != path)
+                continue;
+            auto reloadedProgram = reloadedPrograms.find(shader->_id);
+            if(reloadedProgram == reloadedPrograms.end()) {
+                uint32_t program = ShaderCache::createProgram(shader->_vertPath, shader->_fragPath, shader->_defines);
+                if(!program)
+                    continue;
+                copyUniforms(shader->_id, program);
+                reloadedProgram = reloadedPrograms.emplace(shader->_id, program).first;
+            }
+            shader->_id = reloadedProgram->second;
+        }
+        for(auto& [oldProgram, newProgram] : reloadedPrograms)
+            glDeleteProgram(oldProgram);
+        currentShaderInUseID = UINT32_MAX;
+        glUseProgram(0);
+    }
+
+    void Shader::copyUniforms(uint32_t source, uint32_t destination) {
+        int uniformCount = 0;
+        glGetProgramiv(source, GL_ACTIVE_UNIFORMS, &uniformCount);
+        glUseProgram(destination);
+        for(int i = 0; i < uniformCount; ++i) {
+            char name[256];
+            int size;
+            GLenum type;
+            glGetActiveUniform(source, i, sizeof(name), nullptr, &size, &type, name);
+            std::string baseName = name;
+            if(size > 1 && baseName.size() > 3 && baseName.compare(baseName.size() - 3, 3, "[0]") == 0)
+                baseName.erase(baseName.size() - 3);
+            for(int element = 0; element < size; ++element) {
+                std::string elementName = size > 1 ? baseName + "[" + std::to_string(element) + "]" : baseName;
+                int sourceLocation = glGetUniformLocation(source, elementName.c_str());
+                int destinationLocation = glGetUniformLocation(destination, elementName.c_str());
+                if(sourceLocation < 0 || destinationLocation < 0)
+                    continue;
+                copyUniform(source, type, sourceLocation, destinationLocation);
+            }
+        }
     }
 
+    void Shader::copyUniform(uint32_t source, uint32_t type, int sourceLocation, int destinationLocation) {
+        float floats[16];
+        int ints[4];
+        uint32_t uints[4];
+        switch(type) {
+        case GL_FLOAT:
+        case GL_FLOAT_VEC2:
+        case GL_FLOAT_VEC3:
+        case GL_FLOAT_VEC4:
+            glGetUniformfv(source, sourceLocation, floats);
+            if(type == GL_FLOAT) glUniform1fv(destinationLocation, 1, floats);
+            else if(type == GL_FLOAT_VEC2) glUniform2fv(destinationLocation, 1, floats);
+            else if(type == GL_FLOAT_VEC3) glUniform3fv(destinationLocation, 1, floats);
+            else glUniform4fv(destinationLocation, 1, floats);
+            break;
+        case GL_FLOAT_MAT3:
+            glGetUniformfv(source, sourceLocation, floats);
+            glUniformMatrix3fv(destinationLocation, 1, GL_FALSE, floats);
+            break;
+        case GL_FLOAT_MAT4:
+            glGetUniformfv(source, sourceLocation, floats);
+            glUniformMatrix4fv(destinationLocation, 1, GL_FALSE, floats);
+            break;
+        case GL_INT:
+        case GL_BOOL:
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_2D_ARRAY:
+            glGetUniformiv(source, sourceLocation, ints);
+            glUniform1i(destinationLocation, ints[0]);
+            break;
+        case GL_UNSIGNED_INT:
+            glGetUniformuiv(source, sourceLocation, uints);
+            glUniform1ui(destinationLocation, uints[0]);
+            break;
+        default:
+            break;
+        }
+    }
+    #endif
+
     void Shader::use() {
         if(currentShaderInUseID != _id) {
             glUseProgram(_id);
@@ -81,6 +156,12 @@ namespace TWE {
         glUniform3f(loc, vec.x, vec.y, vec.z);
     }
 
+    void Shader::setUniform(const char* name, const glm::vec2& vec) {
+        use();
+        uint32_t loc = glGetUniformLocation(getId(), name);
+        glUniform2f(loc, vec.x, vec.y);
+    }
+
     void Shader::setUniform(const char* name, float value) {
         use();
         uint32_t loc = glGetUniformLocation(getId(), name);
@@ -105,6 +186,10 @@ namespace TWE {
         glUniform1i(loc, value);    
     }
 
+    void Shader::setUniform(const ShaderUniformSpecification& uniform) {
+        std::visit([&](const auto& value) { setUniform(uniform.name.c_str(), value); }, uniform.value);
+    }
+
     uint32_t Shader::getId() const noexcept { return _id; }
     std::string Shader::getVertPath() const noexcept { return _vertPath; }
     std::string Shader::getFragPath() const noexcept { return _fragPath; }
@@ -117,7 +202,7 @@ namespace TWE {
         "mvp"
     };
 
-    const char* SHADER_PATHS[8] = {
+    const char* SHADER_PATHS[13] = {
         "shaders/default.vert",
         "shaders/default.frag",
         "shaders/cubemap.vert",
@@ -126,5 +211,10 @@ namespace TWE {
         "shaders/collider.frag",
         "shaders/ui.vert",
         "shaders/ui.frag",
+        "shaders/batch2d.vert",
+        "shaders/batch2d.frag",
+        "shaders/gbuffer.frag",
+        "shaders/deferred.vert",
+        "shaders/deferred.frag",
     };
 }
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "renderer/texture-streamer.hpp"
+
+namespace TWE {
+    const size_t TextureStreamer::defaultBudget = 256 * 1024 * 1024;
+    const int TextureStreamer::residentSize = 64;
+    const int TextureStreamer::maxLoadsPerFrame = 2;
+    const uint64_t TextureStreamer::dropDelay = 300;
+    std::map<uint32_t, TextureStreamingSpecification>* TextureStreamer::textures = new std::map<uint32_t, TextureStreamingSpecification>();
+    size_t TextureStreamer::budget = TextureStreamer::defaultBudget;
+    uint64_t TextureStreamer::frame = 0;
+
+    void TextureStreamer::registerTexture(uint32_t id, const std::string& imgPath, uint32_t textureType, uint32_t format, const uint8_t* pixels,
+        int width, int height) {
+        textures->erase(id);
+        auto& texture = (*textures)[id];
+        texture.imgPath = imgPath;
+        texture.textureType = textureType;
+        texture.format = format;
+        texture.width = width;
+        texture.height = height;
+        texture.levelCount = 1;
+        while((std::max(width, height) >> texture.levelCount) > 0)
+            ++texture.levelCount;
+        texture.initialLevel = 0;
+        while(texture.initialLevel < texture.levelCount - 1
+        && std::max(getLevelSize(width, texture.initialLevel), getLevelSize(height, texture.initialLevel)) > residentSize)
+            ++texture.initialLevel;
+        texture.residentLevel = texture.initialLevel;
+        texture.neededLevel = texture.initialLevel;
+        texture.requestedLevel = texture.levelCount;
+        texture.lastRequestFrame = frame;
+        glBindTexture(textureType, id);
+        glTexParameteri(textureType, GL_TEXTURE_BASE_LEVEL, texture.initialLevel);
+        glTexParameteri(textureType, GL_TEXTURE_MAX_LEVEL, texture.levelCount - 1);
+        glTexParameteri(textureType, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glBindTexture(textureType, 0);
+        texture.isLoading = true;
+        uploadLevels(id, texture, generateMipLevels(pixels, width, height, texture.initialLevel, texture.levelCount - 1));
+    }
+
+    void TextureStreamer::unregisterTexture(uint32_t id) {
+        UploadManager::cancel(UploadTargetType::Texture, id);
+        textures->erase(id);
+    }
+
+    void TextureStreamer::requestLevel(uint32_t id, float pixelsPerUV) {
+        auto textureIt = textures->find(id);
+        if(textureIt == textures->end())
+            return;
+        auto& texture = textureIt->second;
+        int level = texture.levelCount - 1;
+        if(pixelsPerUV >= FLT_MAX)
+            level = 0;
+        else if(pixelsPerUV > 0.f)
+            level = static_cast<int>(std::floor(std::log2(std::max(texture.width, texture.height) / pixelsPerUV)));
+        level = std::clamp(level, 0, texture.levelCount - 1);
+        texture.requestedLevel = std::min(texture.requestedLevel, level);
+    }
+
+    void TextureStreamer::update() {
+        ++frame;
+        int loads = 0;
+        for(auto& [id, texture] : *textures) {
+            if(texture.requestedLevel < texture.levelCount) {
+                texture.neededLevel = texture.requestedLevel;
+                texture.lastRequestFrame = frame;
+                texture.requestedLevel = texture.levelCount;
+            }
+            if(texture.isLoading) {
+                if(texture.loadingJob && texture.loadingJob->isDone()) {
+                    auto levels = std::move(*texture.loadedLevels);
+                    texture.loadingJob.reset();
+                    texture.loadedLevels.reset();
+                    uploadLevels(id, texture, std::move(levels));
+                }
+                continue;
+            }
+            if(texture.neededLevel < texture.residentLevel && loads < maxLoadsPerFrame) {
+                loadLevels(id, texture, texture.neededLevel);
+                ++loads;
+            }
+        }
+        size_t residentSize = getResidentSize();
+        if(residentSize <= budget)
+            return;
+        std::vector<std::pair<uint32_t, TextureStreamingSpecification*>> candidates;
+        for(auto& [id, texture] : *textures) {
+            int level = frame - texture.lastRequestFrame > dropDelay ? texture.initialLevel : texture.neededLevel;
+            if(!texture.isLoading && texture.residentLevel < level)
+                candidates.emplace_back(id, &texture);
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const auto& left, const auto& right) {
+            return left.second->lastRequestFrame < right.second->lastRequestFrame;
+        });
+        for(auto& [id, texture] : candidates) {
+            if(residentSize <= budget)
+                break;
+            int level = frame - texture->lastRequestFrame > dropDelay ? texture->initialLevel : texture->neededLevel;
+            residentSize -= getLevelsSize(*texture, texture->residentLevel) - getLevelsSize(*texture, level);
+            dropLevels(id, *texture, level);
+        }
+    }
+
+    void TextureStreamer::loadLevels(uint32_t id, TextureStreamingSpecification& texture, int level) {
+        std::string imgPath = texture.imgPath;
+        int lastLevel = texture.residentLevel - 1;
+        int expectedWidth = texture.width;
+        int expectedHeight = texture.height;
+        auto loadedLevels = std::make_shared<std::vector<TextureMipLevelSpecification>>();
+        texture.isLoading = true;
+        texture.loadedLevels = loadedLevels;
+        texture.loadingJob = JobSystem::submit([loadedLevels, imgPath, level, lastLevel, expectedWidth, expectedHeight]() {
+            int width, height, chanInFile;
+            auto imgBytes = stbi_load(imgPath.c_str(), &width, &height, &chanInFile, 4);
+            if(!imgBytes)
+                return;
+            if(width == expectedWidth && height == expectedHeight)
+                *loadedLevels = generateMipLevels(imgBytes, width, height, level, lastLevel);
+            stbi_image_free(imgBytes);
+        });
+    }
+
+    void TextureStreamer::uploadLevels(uint32_t id, TextureStreamingSpecification& texture, std::vector<TextureMipLevelSpecification>&& levels) {
+        if(levels.empty()) {
+            texture.isLoading = false;
+            return;
+        }
+        glBindTexture(texture.textureType, id);
+        for(auto& level : levels)
+            glTexImage2D(texture.textureType, level.level, texture.format, level.width, level.height, 0, texture.format, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(texture.textureType, 0);
+        int finestLevel = levels.front().level;
+        for(size_t i = 0; i < levels.size(); ++i) {
+            std::function<void()> onUploaded;
+            if(i + 1 == levels.size())
+                onUploaded = [id, finestLevel]() {
+                    auto textureIt = textures->find(id);
+                    if(textureIt == textures->end())
+                        return;
+                    auto& texture = textureIt->second;
+                    glBindTexture(texture.textureType, id);
+                    glTexParameteri(texture.textureType, GL_TEXTURE_BASE_LEVEL, finestLevel);
+                    glBindTexture(texture.textureType, 0);
+                    texture.residentLevel = std::min(texture.residentLevel, finestLevel);
+                    texture.isLoading = false;
+                };
+            UploadManager::uploadTexture(id, texture.textureType, levels[i].level, levels[i].width, levels[i].height, texture.format, GL_UNSIGNED_BYTE,
+                std::move(levels[i].pixels), onUploaded);
+        }
+    }
+
+    void TextureStreamer::dropLevels(uint32_t id, TextureStreamingSpecification& texture, int level) {
+        glBindTexture(texture.textureType, id);
+        glTexParameteri(texture.textureType, GL_TEXTURE_BASE_LEVEL, level);
+        for(int i = texture.residentLevel; i < level; ++i)
+            glTexImage2D(texture.textureType, i, texture.format, 0, 0, 0, texture.format, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(texture.textureType, 0);
+        texture.residentLevel = level;
+    }
+
+    std::vector<TextureMipLevelSpecification> TextureStreamer::generateMipLevels(const uint8_t* pixels, int width, int height, int firstLevel, int lastLevel) {
+        std::vector<TextureMipLevelSpecification> levels;
+        std::vector<uint8_t> current;
+        std::vector<uint8_t> next;
+        const uint8_t* source = pixels;
+        for(int level = 0; level <= lastLevel; ++level) {
+            if(level >= firstLevel)
+                levels.emplace_back(level, width, height, std::vector<uint8_t>(source, source + static_cast<size_t>(width) * height * 4));
+            if(level == lastLevel)
+                break;
+            downsample(source, width, height, next);
+            current.swap(next);
+            source = current.data();
+            width = std::max(width / 2, 1);
+            height = std::max(height / 2, 1);
+        }
+        return levels;
+    }
+
+    void TextureStreamer::downsample(const uint8_t* source, int width, int height, std::vector<uint8_t>& result) {
+        int resultWidth = std::max(width / 2, 1);
+        int resultHeight = std::max(height / 2, 1);
+        result.resize(static_cast<size_t>(resultWidth) * resultHeight * 4);
+        for(int y = 0; y < resultHeight; ++y) {
+            const uint8_t* row0 = source + static_cast<size_t>(std::min(y * 2, height - 1)) * width * 4;
+            const uint8_t* row1 = source + static_cast<size_t>(std::min(y * 2 + 1, height - 1)) * width * 4;
+            uint8_t* dest = result.data() + static_cast<size_t>(y) * resultWidth * 4;
+            for(int x = 0; x < resultWidth; ++x) {
+                int x0 = std::min(x * 2, width - 1) * 4;
+                int x1 = std::min(x * 2 + 1, width - 1) * 4;
+                for(int channel = 0; channel < 4; ++channel)
+                    dest[x * 4 + channel] = static_cast<uint8_t>((row0[x0 + channel] + row0[x1 + channel] + row1[x0 + channel] + row1[x1 + channel] + 2) / 4);
+            }
+        }
+    }
+
+    size_t TextureStreamer::getResidentSize() {
+        size_t residentSize = 0;
+        for(auto& [id, texture] : *textures)
+            residentSize += getLevelsSize(texture, texture.residentLevel);
+        return residentSize;
+    }
+
+    size_t TextureStreamer::getLevelsSize(const TextureStreamingSpecification& texture, int firstLevel) {
+        size_t size = 0;
+        for(int level = firstLevel; level < texture.levelCount; ++level)
+            size += static_cast<size_t>(getLevelSize(texture.width, level)) * getLevelSize(texture.height, level) * 4;
+        return size;
+    }
+
+    int TextureStreamer::getLevelSize(int size, int level) {
+        return std::max(size >> level, 1);
+    }
+
+    void TextureStreamer::setBudget(size_t budget) {
+        TextureStreamer::budget = budget;
+    }
+
+    size_t TextureStreamer::getBudget() noexcept { return budget; }
+}
\ No newline at end of file
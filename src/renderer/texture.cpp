@@ -3,12 +3,19 @@
 namespace TWE {
     Texture::Texture(const TextureAttachmentSpecification& attachments)
     : _attachments(attachments) {
-        if(!_attachments.textureSpecifications.empty() && _attachments.textureSpecifications[0].texType == TextureType::CubemapTexture) {
-            generateCubemapTexture(_attachments);
-            return;
-        }
-        for(auto& specification : _attachments.textureSpecifications)
-            create(specification);
+        auto createAttachments = [this]() {
+            if(!_attachments.textureSpecifications.empty() && _attachments.textureSpecifications[0].texType == TextureType::CubemapTexture) {
+                generateCubemapTexture(_attachments);
+                return;
+            }
+            for(auto& specification : _attachments.textureSpecifications)
+                create(specification);
+        };
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        JobSystem::runOnMainThread(createAttachments);
+        #else
+        createAttachments();
+        #endif
     }
 
     Texture::Texture(const Texture& texture) {
@@ -16,7 +23,17 @@ namespace TWE {
     }
 
     Texture::~Texture() {
-        clean();
+        if(JobSystem::isMainThread()) {
+            clean();
+            return;
+        }
+        auto textureSpecifications = _attachments.textureSpecifications;
+        JobSystem::submit([textureSpecifications]() {
+            for(auto& specification : textureSpecifications) {
+                TextureStreamer::unregisterTexture(specification.id);
+                glDeleteTextures(1, &specification.id);
+            }
+        }, {}, JobAffinity::MainThread);
     }
 
     void Texture::bind(){
@@ -32,8 +49,15 @@ namespace TWE {
     }
 
     void Texture::clean(){
-        for(auto& specification : _attachments.textureSpecifications)
+        for(auto& specification : _attachments.textureSpecifications) {
+            TextureStreamer::unregisterTexture(specification.id);
             glDeleteTextures(1, &specification.id);
+        }
+    }
+
+    void Texture::requestLevel(float pixelsPerUV) {
+        for(auto& specification : _attachments.textureSpecifications)
+            TextureStreamer::requestLevel(specification.id, pixelsPerUV);
     }
 
     void Texture::setAttachments(const TextureAttachmentSpecification& attachments) {
@@ -49,6 +73,7 @@ namespace TWE {
         else
             _attachments.textureSpecifications[index] = textureSpec;
         glBindTexture((GLenum)_attachments.textureSpecifications[index].texType, 0);
+        TextureStreamer::unregisterTexture(_attachments.textureSpecifications[index].id);
         glDeleteTextures(1, &_attachments.textureSpecifications[index].id);
         create(_attachments.textureSpecifications[index]);
     }
@@ -58,6 +83,7 @@ namespace TWE {
         if(index == -1)
             return;
         glBindTexture((GLenum)_attachments.textureSpecifications[index].texType, 0);
+        TextureStreamer::unregisterTexture(_attachments.textureSpecifications[index].id);
         glDeleteTextures(1, &_attachments.textureSpecifications[index].id);
         _attachments.textureSpecifications.erase(_attachments.textureSpecifications.begin() + index);
     }
@@ -83,10 +109,14 @@ namespace TWE {
         glTexParameteri(textureType, GL_TEXTURE_WRAP_T, GL_REPEAT);
         glTexParameteri(textureType, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(textureType, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexImage2D(textureType, 0, textureInOutFormat, width, height, 0, textureInOutFormat, GL_UNSIGNED_BYTE, imgBytes);
-        glGenerateMipmap(textureType);
-        stbi_image_free(imgBytes);
+        if(!imgBytes) {
+            glTexImage2D(textureType, 0, textureInOutFormat, width, height, 0, textureInOutFormat, GL_UNSIGNED_BYTE, nullptr);
+            glBindTexture(textureType, 0);
+            return;
+        }
         glBindTexture(textureType, 0);
+        TextureStreamer::registerTexture(textureSpecification.id, textureSpecification.imgPath, textureType, textureInOutFormat, imgBytes, width, height);
+        stbi_image_free(imgBytes);
     }
 
     uint32_t Texture::getIndexByTexNumber(uint32_t texNumber) const noexcept {
@@ -0,0 +1,199 @@
+#include "renderer/upload-manager.hpp"
+
+namespace TWE {
+    const size_t UploadManager::defaultFrameBudget = 8 * 1024 * 1024;
+    const int UploadManager::stagingBufferCount = 3;
+    std::deque<UploadRequestSpecification> UploadManager::requests;
+    std::deque<UploadFenceSpecification> UploadManager::fences;
+    std::vector<uint32_t> UploadManager::stagingBuffers;
+    int UploadManager::stagingIndex = 0;
+    size_t UploadManager::frameBudget = UploadManager::defaultFrameBudget;
+    size_t UploadManager::pendingSize = 0;
+    uint64_t UploadManager::nextTicket = 1;
+    uint64_t UploadManager::completedTicket = 0;
+    bool UploadManager::isInitialized = false;
+
+    void UploadManager::init(size_t frameBudget) {
+        if(isInitialized)
+            return;
+        UploadManager::frameBudget = frameBudget;
+        stagingBuffers.resize(stagingBufferCount);
+        glGenBuffers(stagingBufferCount, stagingBuffers.data());
+        isInitialized = true;
+    }
+
+    void UploadManager::update() {
+        pollFences();
+        if(requests.empty())
+            return;
+        uint32_t stagingBuffer = stagingBuffers[stagingIndex];
+        stagingIndex = (stagingIndex + 1) % stagingBufferCount;
+        glBindBuffer(GL_COPY_READ_BUFFER, stagingBuffer);
+        glBufferData(GL_COPY_READ_BUFFER, frameBudget, nullptr, GL_STREAM_DRAW);
+        uint8_t* staging = static_cast<uint8_t*>(glMapBufferRange(GL_COPY_READ_BUFFER, 0, frameBudget, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+        if(!staging) {
+            glBindBuffer(GL_COPY_READ_BUFFER, 0);
+            return;
+        }
+        std::vector<UploadChunkSpecification> chunks;
+        size_t stagingOffset = 0;
+        for(auto& request : requests) {
+            size_t size = std::min(request.data.size() - request.uploadedSize, frameBudget - stagingOffset);
+            if(request.targetType == UploadTargetType::Texture) {
+                size_t rowSize = getRowSize(request);
+                if(rowSize > frameBudget) {
+                    uploadDirect(request);
+                    continue;
+                }
+                size = size / rowSize * rowSize;
+            }
+            if(size == 0)
+                break;
+            std::memcpy(staging + stagingOffset, request.data.data() + request.uploadedSize, size);
+            chunks.emplace_back(&request, stagingOffset, request.uploadedSize, size);
+            request.uploadedSize += size;
+            pendingSize -= size;
+            stagingOffset = (stagingOffset + size + 15) & ~static_cast<size_t>(15);
+            if(stagingOffset >= frameBudget || request.uploadedSize < request.data.size())
+                break;
+        }
+        glUnmapBuffer(GL_COPY_READ_BUFFER);
+        for(auto& chunk : chunks)
+            uploadChunk(chunk, stagingBuffer);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        uint64_t lastTicket = 0;
+        while(!requests.empty() && requests.front().uploadedSize == requests.front().data.size()) {
+            auto onUploaded = std::move(requests.front().onUploaded);
+            lastTicket = requests.front().ticket;
+            requests.pop_front();
+            if(onUploaded)
+                onUploaded();
+        }
+        if(lastTicket != 0)
+            fences.emplace_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0), lastTicket);
+    }
+
+    uint64_t UploadManager::uploadBuffer(uint32_t buffer, const void* data, size_t size, size_t destinationOffset) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        return uploadBuffer(buffer, std::vector<uint8_t>(bytes, bytes + size), destinationOffset);
+    }
+
+    uint64_t UploadManager::uploadBuffer(uint32_t buffer, std::vector<uint8_t>&& data, size_t destinationOffset) {
+        UploadRequestSpecification request(UploadTargetType::Buffer, buffer, std::move(data));
+        request.destinationOffset = destinationOffset;
+        return submit(std::move(request));
+    }
+
+    uint64_t UploadManager::uploadTexture(uint32_t texture, uint32_t textureType, int level, int width, int height, uint32_t format, uint32_t type,
+        std::vector<uint8_t>&& data, const std::function<void()>& onUploaded) {
+        UploadRequestSpecification request(UploadTargetType::Texture, texture, std::move(data));
+        request.textureType = textureType;
+        request.level = level;
+        request.width = width;
+        request.height = height;
+        request.format = format;
+        request.type = type;
+        request.onUploaded = onUploaded;
+        return submit(std::move(request));
+    }
+
+    uint64_t UploadManager::submit(UploadRequestSpecification&& request) {
+        if(!isInitialized || request.data.empty()) {
+            uploadDirect(request);
+            if(request.onUploaded)
+                request.onUploaded();
+            return 0;
+        }
+        request.ticket = nextTicket++;
+        pendingSize += request.data.size();
+        requests.push_back(std::move(request));
+        return requests.back().ticket;
+    }
+
+    void UploadManager::uploadDirect(UploadRequestSpecification& request) {
+        if(request.data.empty())
+            return;
+        if(request.targetType == UploadTargetType::Buffer) {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, request.destination);
+            glBufferSubData(GL_COPY_WRITE_BUFFER, request.destinationOffset + request.uploadedSize, request.data.size() - request.uploadedSize,
+                request.data.data() + request.uploadedSize);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        } else {
+            size_t rowSize = getRowSize(request);
+            glBindTexture(request.textureType, request.destination);
+            glTexSubImage2D(request.textureType, request.level, 0, static_cast<int>(request.uploadedSize / rowSize), request.width,
+                static_cast<int>((request.data.size() - request.uploadedSize) / rowSize), request.format, request.type, request.data.data() + request.uploadedSize);
+            glBindTexture(request.textureType, 0);
+        }
+        if(isInitialized)
+            pendingSize -= request.data.size() - request.uploadedSize;
+        request.uploadedSize = request.data.size();
+    }
+
+    void UploadManager::uploadChunk(const UploadChunkSpecification& chunk, uint32_t stagingBuffer) {
+        auto& request = *chunk.request;
+        if(request.targetType == UploadTargetType::Buffer) {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, request.destination);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, chunk.stagingOffset, request.destinationOffset + chunk.dataOffset, chunk.size);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+            return;
+        }
+        size_t rowSize = getRowSize(request);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingBuffer);
+        glBindTexture(request.textureType, request.destination);
+        glTexSubImage2D(request.textureType, request.level, 0, static_cast<int>(chunk.dataOffset / rowSize), request.width, static_cast<int>(chunk.size / rowSize),
+            request.format, request.type, (void*)static_cast<uintptr_t>(chunk.stagingOffset));
+        glBindTexture(request.textureType, 0);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    void UploadManager::pollFences() {
+        while(!fences.empty()) {
+            auto& fence = fences.front();
+            GLenum status = glClientWaitSync(fence.fence, 0, 0);
+            if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                break;
+            completedTicket = fence.ticket;
+            glDeleteSync(fence.fence);
+            fences.pop_front();
+        }
+    }
+
+    void UploadManager::cancel(uint64_t ticket) {
+        if(ticket == 0)
+            return;
+        cancel([ticket](const UploadRequestSpecification& request) { return request.ticket == ticket; });
+    }
+
+    void UploadManager::cancel(UploadTargetType targetType, uint32_t destination) {
+        if(destination == 0)
+            return;
+        cancel([targetType, destination](const UploadRequestSpecification& request) {
+            return request.targetType == targetType && request.destination == destination;
+        });
+    }
+
+    void UploadManager::cancel(const std::function<bool(const UploadRequestSpecification&)>& isCancelled) {
+        for(auto requestIt = requests.begin(); requestIt != requests.end();) {
+            if(!isCancelled(*requestIt)) {
+                ++requestIt;
+                continue;
+            }
+            pendingSize -= requestIt->data.size() - requestIt->uploadedSize;
+            requestIt = requests.erase(requestIt);
+        }
+    }
+
+    void UploadManager::setFrameBudget(size_t frameBudget) {
+        UploadManager::frameBudget = std::max<size_t>(frameBudget, 64 * 1024);
+    }
+
+    size_t UploadManager::getRowSize(const UploadRequestSpecification& request) {
+        return request.height > 0 ? request.data.size() / request.height : request.data.size();
+    }
+
+    bool UploadManager::isUploaded(uint64_t ticket) noexcept { return requests.empty() || ticket < requests.front().ticket; }
+    bool UploadManager::isComplete(uint64_t ticket) noexcept { return ticket <= completedTicket; }
+    size_t UploadManager::getFrameBudget() noexcept { return frameBudget; }
+    size_t UploadManager::getPendingSize() noexcept { return pendingSize; }
+}
\ No newline at end of file
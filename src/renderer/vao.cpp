@@ -10,7 +10,12 @@ namespace TWE {
     }
 
     VAO::~VAO() {
-        clean();
+        if(JobSystem::isMainThread()) {
+            clean();
+            return;
+        }
+        uint32_t id = _id;
+        JobSystem::submit([id]() { glDeleteVertexArrays(1, &id); }, {}, JobAffinity::MainThread);
     }
 
     void VAO::setAttrib(uint32_t layout, int size, uint32_t type, bool normalized, int step, const void* offset, VBO& vbo) {
@@ -20,6 +25,12 @@ namespace TWE {
         vbo.unbind();
     }
 
+    void VAO::setLayout(const VertexLayout& layout, VBO& vbo) {
+        for(auto& attribute : layout.getAttributes())
+            setAttrib(attribute.location, VertexLayout::getFormatComponents(attribute.format), VertexLayout::getFormatType(attribute.format),
+                VertexLayout::getFormatNormalized(attribute.format), layout.getStride(), (void*)static_cast<uintptr_t>(attribute.offset), vbo);
+    }
+
     void VAO::bind() {
         glBindVertexArray(_id);
     }
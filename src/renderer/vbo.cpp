@@ -1,22 +1,49 @@
 #include "renderer/vbo.hpp"
 
 namespace TWE {
-    VBO::VBO(float* vertices, long int size, uint32_t drawType)
-    : _vertices(vertices), _size(size) {
+    VBO::VBO(float* vertices, long int size, uint32_t drawType, const VertexLayout& layout, bool ownsVertices)
+    : _vertices(vertices), _size(size), _bufferSize(size), _layout(layout), _ownsVertices(ownsVertices) {
+        int vertexCount = getVertexCount();
+        _positions.resize(static_cast<size_t>(vertexCount) * 3);
+        for(int i = 0; i < vertexCount; ++i)
+            std::memcpy(_positions.data() + static_cast<size_t>(i) * 3, vertices + static_cast<size_t>(i) * VertexLayout::sourceStride, 3 * sizeof(float));
         glGenBuffers(1, &_id);
         glBindBuffer(GL_ARRAY_BUFFER, _id);
-        glBufferData(GL_ARRAY_BUFFER, size, vertices, drawType);
+        if(_layout.isDefault()) {
+            glBufferData(GL_ARRAY_BUFFER, size, nullptr, drawType);
+            _uploadTicket = UploadManager::uploadBuffer(_id, vertices, size);
+        } else {
+            std::vector<uint8_t> packed;
+            _layout.pack(vertices, getVertexCount(), packed);
+            _bufferSize = static_cast<long int>(packed.size());
+            glBufferData(GL_ARRAY_BUFFER, _bufferSize, nullptr, drawType);
+            _uploadTicket = UploadManager::uploadBuffer(_id, std::move(packed));
+        }
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     VBO::VBO(const VBO& vbo) {
         this->_id = vbo._id;
         this->_vertices = vbo._vertices;
+        this->_positions = vbo._positions;
+        this->_ownsVertices = false;
         this->_size = vbo._size;
+        this->_bufferSize = vbo._bufferSize;
+        this->_layout = vbo._layout;
+        this->_uploadTicket = vbo._uploadTicket;
     }
 
     VBO::~VBO() {
-        clean();
+        if(JobSystem::isMainThread())
+            clean();
+        else {
+            uint32_t id = _id;
+            JobSystem::submit([id]() {
+                UploadManager::cancel(UploadTargetType::Buffer, id);
+                glDeleteBuffers(1, &id);
+            }, {}, JobAffinity::MainThread);
+        }
+        releaseVertices();
     }
 
     void VBO::bind(){
@@ -28,10 +55,23 @@ namespace TWE {
     }
 
     void VBO::clean(){
+        UploadManager::cancel(UploadTargetType::Buffer, _id);
         glDeleteBuffers(1, &_id);
     }
 
+    void VBO::releaseVertices() {
+        if(_ownsVertices)
+            delete[] _vertices;
+        _vertices = nullptr;
+    }
+
     uint32_t VBO::getId() { return _id; }
     float* VBO::getVertices() { return _vertices; }
+    const float* VBO::getPositions() { return _positions.data(); }
     long int VBO::getSize() { return _size; }
+    long int VBO::getBufferSize() { return _bufferSize; }
+    int VBO::getVertexCount() { return static_cast<int>(_size / sizeof(float) / VertexLayout::sourceStride); }
+    long int VBO::getCPUSize() { return static_cast<long int>(_positions.size() * sizeof(float)) + (_vertices ? _size : 0); }
+    const VertexLayout& VBO::getLayout() { return _layout; }
+    bool VBO::getIsUploaded() { return UploadManager::isUploaded(_uploadTicket); }
 }
\ No newline at end of file
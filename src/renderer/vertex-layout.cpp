@@ -0,0 +1,161 @@
+#include "renderer/vertex-layout.hpp"
+
+namespace TWE {
+    const int VertexLayout::sourceStride = 8;
+
+    VertexLayout::VertexLayout(): VertexLayout({
+        { VertexAttributeLocation::POSITION, VertexAttributeFormat::Float3 },
+        { VertexAttributeLocation::NORMAL, VertexAttributeFormat::Float3 },
+        { VertexAttributeLocation::UV, VertexAttributeFormat::Float2 }
+    }) {}
+
+    VertexLayout::VertexLayout(std::initializer_list<VertexAttributeSpecification> attributes)
+    : _attributes(attributes) {
+        calculateOffsets();
+    }
+
+    VertexLayout VertexLayout::createDefault() {
+        return VertexLayout();
+    }
+
+    VertexLayout VertexLayout::createCompact(bool quantizePositions) {
+        return VertexLayout({
+            { VertexAttributeLocation::POSITION, quantizePositions ? VertexAttributeFormat::Snorm16x4 : VertexAttributeFormat::Float3 },
+            { VertexAttributeLocation::NORMAL, VertexAttributeFormat::Snorm10x3 },
+            { VertexAttributeLocation::UV, VertexAttributeFormat::Half2 }
+        });
+    }
+
+    void VertexLayout::calculateOffsets() {
+        _stride = 0;
+        for(auto& attribute : _attributes) {
+            attribute.offset = _stride;
+            _stride += getFormatSize(attribute.format);
+        }
+    }
+
+    void VertexLayout::calculateDequantization(const float* vertices, int vertexCount) {
+        _dequantization = {};
+        if(vertexCount <= 0)
+            return;
+        glm::vec3 minPosition = glm::vec3(vertices[0], vertices[1], vertices[2]);
+        glm::vec3 maxPosition = minPosition;
+        for(int i = 1; i < vertexCount; ++i) {
+            const float* vertex = vertices + i * sourceStride;
+            minPosition = glm::min(minPosition, glm::vec3(vertex[0], vertex[1], vertex[2]));
+            maxPosition = glm::max(maxPosition, glm::vec3(vertex[0], vertex[1], vertex[2]));
+        }
+        for(auto& attribute : _attributes) {
+            if(attribute.location == VertexAttributeLocation::POSITION && attribute.format == VertexAttributeFormat::Snorm16x4) {
+                _dequantization.positionScale = glm::max((maxPosition - minPosition) * 0.5f, glm::vec3(1e-6f));
+                _dequantization.positionOffset = (maxPosition + minPosition) * 0.5f;
+            }
+        }
+    }
+
+    void VertexLayout::pack(const float* vertices, int vertexCount, std::vector<uint8_t>& packed) {
+        calculateDequantization(vertices, vertexCount);
+        packed.resize(static_cast<size_t>(vertexCount) * _stride);
+        for(int i = 0; i < vertexCount; ++i) {
+            const float* vertex = vertices + i * sourceStride;
+            uint8_t* dest = packed.data() + static_cast<size_t>(i) * _stride;
+            for(auto& attribute : _attributes)
+                packAttribute(attribute, vertex, dest + attribute.offset);
+        }
+    }
+
+    void VertexLayout::packAttribute(const VertexAttributeSpecification& attribute, const float* vertex, uint8_t* dest) {
+        const float* source = vertex;
+        switch (attribute.location) {
+        case VertexAttributeLocation::NORMAL:
+            source = vertex + 3;
+            break;
+        case VertexAttributeLocation::UV:
+            source = vertex + 6;
+            break;
+        default:
+            break;
+        }
+        switch (attribute.format) {
+        case VertexAttributeFormat::Float2:
+            std::memcpy(dest, source, 2 * sizeof(float));
+            break;
+        case VertexAttributeFormat::Float3:
+            std::memcpy(dest, source, 3 * sizeof(float));
+            break;
+        case VertexAttributeFormat::Half2: {
+            uint32_t value = glm::packHalf2x16({ source[0], source[1] });
+            std::memcpy(dest, &value, sizeof(value));
+        } break;
+        case VertexAttributeFormat::Snorm16x4: {
+            glm::vec3 value = { source[0], source[1], source[2] };
+            if(attribute.location == VertexAttributeLocation::POSITION)
+                value = (value - _dequantization.positionOffset) / _dequantization.positionScale;
+            uint64_t packedValue = glm::packSnorm4x16({ value, 0.f });
+            std::memcpy(dest, &packedValue, sizeof(packedValue));
+        } break;
+        case VertexAttributeFormat::Snorm10x3: {
+            glm::vec3 value = { source[0], source[1], source[2] };
+            float length = glm::length(value);
+            if(length > 0.f)
+                value /= length;
+            uint32_t packedValue = glm::packSnorm3x10_1x2({ value, 0.f });
+            std::memcpy(dest, &packedValue, sizeof(packedValue));
+        } break;
+        }
+    }
+
+    bool VertexLayout::isDefault() const noexcept {
+        return _attributes == VertexLayout()._attributes;
+    }
+
+    uint32_t VertexLayout::getFormatSize(VertexAttributeFormat format) noexcept {
+        switch (format) {
+        case VertexAttributeFormat::Float2: return 2 * sizeof(float);
+        case VertexAttributeFormat::Float3: return 3 * sizeof(float);
+        case VertexAttributeFormat::Snorm16x4: return 4 * sizeof(int16_t);
+        default: return sizeof(uint32_t);
+        }
+    }
+
+    int VertexLayout::getFormatComponents(VertexAttributeFormat format) noexcept {
+        switch (format) {
+        case VertexAttributeFormat::Float3:
+        case VertexAttributeFormat::Snorm16x4:
+            return 3;
+        case VertexAttributeFormat::Snorm10x3:
+            return 4;
+        default:
+            return 2;
+        }
+    }
+
+    uint32_t VertexLayout::getFormatType(VertexAttributeFormat format) noexcept {
+        switch (format) {
+        case VertexAttributeFormat::Float2:
+        case VertexAttributeFormat::Float3:
+            return GL_FLOAT;
+        case VertexAttributeFormat::Half2:
+            return GL_HALF_FLOAT;
+        case VertexAttributeFormat::Snorm10x3:
+            return GL_INT_2_10_10_10_REV;
+        default:
+            return GL_SHORT;
+        }
+    }
+
+    bool VertexLayout::getFormatNormalized(VertexAttributeFormat format) noexcept {
+        switch (format) {
+        case VertexAttributeFormat::Float2:
+        case VertexAttributeFormat::Float3:
+        case VertexAttributeFormat::Half2:
+            return false;
+        default:
+            return true;
+        }
+    }
+
+    uint32_t VertexLayout::getStride() const noexcept { return _stride; }
+    const std::vector<VertexAttributeSpecification>& VertexLayout::getAttributes() const noexcept { return _attributes; }
+    const VertexDequantizationSpecification& VertexLayout::getDequantization() const noexcept { return _dequantization; }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "scene/asset-manager.hpp"
+#include "scene/shape.hpp"
+
+namespace TWE {
+    const size_t AssetManager::defaultCPUBudget = 512 * 1024 * 1024;
+    const size_t AssetManager::defaultGPUBudget = 512 * 1024 * 1024;
+    const uint64_t AssetManager::evictionDelay = 120;
+    std::map<std::string, AssetResidencySpecification> AssetManager::assets;
+    size_t AssetManager::cpuSize = 0;
+    size_t AssetManager::gpuSize = 0;
+    size_t AssetManager::cpuBudget = AssetManager::defaultCPUBudget;
+    size_t AssetManager::gpuBudget = AssetManager::defaultGPUBudget;
+    uint64_t AssetManager::frame = 0;
+
+    void AssetManager::update() {
+        ++frame;
+        for(auto& [key, asset] : assets)
+            if(asset.isResident && isReferenced(asset))
+                asset.lastUsedFrame = frame;
+        if(cpuSize <= cpuBudget && gpuSize <= gpuBudget)
+            return;
+        std::vector<AssetResidencySpecification*> candidates;
+        for(auto& [key, asset] : assets)
+            if(asset.isResident && asset.lastUsedFrame + evictionDelay < frame)
+                candidates.push_back(&asset);
+        std::sort(candidates.begin(), candidates.end(), [](AssetResidencySpecification* left, AssetResidencySpecification* right) {
+            return left->lastUsedFrame < right->lastUsedFrame;
+        });
+        for(auto asset : candidates) {
+            if(cpuSize <= cpuBudget && gpuSize <= gpuBudget)
+                break;
+            evict(*asset);
+        }
+    }
+
+    void AssetManager::reset() {
+        assets.clear();
+        cpuSize = 0;
+        gpuSize = 0;
+    }
+
+    void AssetManager::trackModel(const std::filesystem::path& modelPath, const std::vector<MeshSpecification*>& meshSpecifications) {
+        if(meshSpecifications.empty())
+            return;
+        auto& asset = assets[getAssetKey(modelPath)];
+        if(asset.isResident) {
+            cpuSize -= asset.cpuSize;
+            gpuSize -= asset.gpuSize;
+        }
+        asset.modelPath = modelPath;
+        asset.meshIds.clear();
+        asset.cpuSize = 0;
+        asset.gpuSize = 0;
+        std::vector<VBO*> vbos;
+        std::vector<EBO*> ebos;
+        for(auto meshSpecification : meshSpecifications) {
+            asset.meshIds.push_back(meshSpecification->meshId);
+            if(std::find(vbos.begin(), vbos.end(), meshSpecification->vbo.get()) == vbos.end()) {
+                vbos.push_back(meshSpecification->vbo.get());
+                asset.cpuSize += meshSpecification->vbo->getCPUSize();
+                asset.gpuSize += meshSpecification->vbo->getBufferSize();
+            }
+            if(std::find(ebos.begin(), ebos.end(), meshSpecification->ebo.get()) == ebos.end()) {
+                ebos.push_back(meshSpecification->ebo.get());
+                asset.cpuSize += meshSpecification->ebo->getCPUSize();
+                asset.gpuSize += meshSpecification->ebo->getSize();
+            }
+            if(meshSpecification->lodChain)
+                for(size_t i = 1; i < meshSpecification->lodChain->lods.size(); ++i) {
+                    asset.cpuSize += meshSpecification->lodChain->lods[i].ebo->getCPUSize();
+                    asset.gpuSize += meshSpecification->lodChain->lods[i].ebo->getSize();
+                }
+        }
+        asset.lastUsedFrame = frame;
+        asset.isResident = true;
+        cpuSize += asset.cpuSize;
+        gpuSize += asset.gpuSize;
+    }
+
+    void AssetManager::touch(const std::filesystem::path& modelPath) {
+        auto asset = assets.find(getAssetKey(modelPath));
+        if(asset != assets.end())
+            asset->second.lastUsedFrame = frame;
+    }
+
+    std::shared_ptr<AssetReferenceSpecification> AssetManager::acquire(const std::filesystem::path& modelPath) {
+        auto& asset = assets[getAssetKey(modelPath)];
+        auto reference = asset.reference.lock();
+        if(!reference) {
+            reference = std::make_shared<AssetReferenceSpecification>(modelPath);
+            asset.reference = reference;
+        }
+        return reference;
+    }
+
+    bool AssetManager::evict(const std::filesystem::path& modelPath) {
+        auto asset = assets.find(getAssetKey(modelPath));
+        if(asset == assets.end() || !asset->second.isResident || isReferenced(asset->second))
+            return false;
+        evict(asset->second);
+        return true;
+    }
+
+    void AssetManager::evict(AssetResidencySpecification& asset) {
+        for(auto& meshId : asset.meshIds) {
+            auto meshSpecification = Shape::shapeSpec->meshRegistry->get(meshId);
+            if(!meshSpecification)
+                continue;
+            meshSpecification->vao = nullptr;
+            meshSpecification->vbo = nullptr;
+            meshSpecification->ebo = nullptr;
+            meshSpecification->lodChain = nullptr;
+        }
+        cpuSize -= asset.cpuSize;
+        gpuSize -= asset.gpuSize;
+        asset.isResident = false;
+    }
+
+    void AssetManager::setBudgets(size_t cpuBudget, size_t gpuBudget) {
+        AssetManager::cpuBudget = cpuBudget;
+        AssetManager::gpuBudget = gpuBudget;
+    }
+
+    bool AssetManager::isResident(const std::filesystem::path& modelPath) {
+        auto asset = assets.find(getAssetKey(modelPath));
+        return asset != assets.end() && asset->second.isResident;
+    }
+
+    bool AssetManager::isReferenced(const AssetResidencySpecification& asset) {
+        return !asset.reference.expired();
+    }
+
+    std::string AssetManager::getAssetKey(const std::filesystem::path& modelPath) {
+        return std::filesystem::absolute(modelPath).lexically_normal().string();
+    }
+
+    size_t AssetManager::getCPUSize() noexcept { return cpuSize; }
+    size_t AssetManager::getGPUSize() noexcept { return gpuSize; }
+    size_t AssetManager::getCPUBudget() noexcept { return cpuBudget; }
+    size_t AssetManager::getGPUBudget() noexcept { return gpuBudget; }
+}
\ No newline at end of file
@@ -1,12 +1,30 @@
 #include "scene/components/camera-component.hpp"
 
 namespace TWE {
+    std::vector<std::string> cameraUpdateModes = {
+        "Every frame",
+        "Every N frames",
+        "On demand"
+    };
+
+    const FBOAttachmentSpecification CameraComponent::renderTargetAttachments = { FBOTextureFormat::RGBA8, FBOTextureFormat::DEPTH24STENCIL8 };
+
     CameraComponent::CameraComponent() {
+        _viewport = { 0.f, 0.f, 1.f, 1.f };
+        _renderPath = RenderPath::Default;
+        _framesSinceRender = 0;
+        _needRender = true;
         _isFocusedOn = true;
     }
 
     CameraComponent::CameraComponent(const CameraComponent& cameraComponent) {
         this->_camera = cameraComponent._camera;
+        this->_renderTargetSpecification = cameraComponent._renderTargetSpecification;
+        this->_renderTarget = nullptr;
+        this->_viewport = cameraComponent._viewport;
+        this->_renderPath = cameraComponent._renderPath;
+        this->_framesSinceRender = cameraComponent._framesSinceRender;
+        this->_needRender = true;
         this->_isFocusedOn = cameraComponent._isFocusedOn;
     }
 
@@ -22,6 +40,65 @@ namespace TWE {
         _isFocusedOn = isFocusedOn;
     }
 
+    void CameraComponent::setRenderTargetSpecification(const CameraRenderTargetSpecification& renderTargetSpecification) {
+        _renderTargetSpecification = renderTargetSpecification;
+        _renderTargetSpecification.updateInterval = std::max(_renderTargetSpecification.updateInterval, 1);
+        if(!hasRenderTarget())
+            _renderTarget = nullptr;
+        _needRender = true;
+    }
+
+    void CameraComponent::setViewport(const glm::vec4& viewport) {
+        _viewport = glm::clamp(viewport, glm::vec4(0.f), glm::vec4(1.f));
+    }
+
+    void CameraComponent::setRenderPath(RenderPath renderPath) {
+        _renderPath = renderPath;
+    }
+
+    void CameraComponent::requestRender() {
+        _needRender = true;
+    }
+
+    bool CameraComponent::shouldRender() {
+        ++_framesSinceRender;
+        bool isDue = _needRender;
+        switch(_renderTargetSpecification.updateMode) {
+        case CameraUpdateMode::EveryFrame:
+            isDue = true;
+            break;
+        case CameraUpdateMode::EveryNFrames:
+            isDue = isDue || _framesSinceRender >= _renderTargetSpecification.updateInterval;
+            break;
+        case CameraUpdateMode::OnDemand:
+            break;
+        }
+        if(isDue) {
+            _framesSinceRender = 0;
+            _needRender = false;
+        }
+        return isDue;
+    }
+
+    std::shared_ptr<FBO> CameraComponent::getRenderTarget() {
+        if(!hasRenderTarget())
+            return nullptr;
+        auto width = _renderTargetSpecification.width;
+        auto height = _renderTargetSpecification.height;
+        if(!_renderTarget || _renderTarget->getSize().width != width || _renderTarget->getSize().height != height)
+            _renderTarget = std::make_shared<FBO>(width, height, renderTargetAttachments);
+        return _renderTarget;
+    }
+
+    uint32_t CameraComponent::getRenderTexture() {
+        auto renderTarget = getRenderTarget();
+        return renderTarget ? renderTarget->getColorAttachment(0) : 0;
+    }
+
     bool CameraComponent::isFocusedOn() const noexcept { return _isFocusedOn; }
+    bool CameraComponent::hasRenderTarget() const noexcept { return _renderTargetSpecification.width > 0 && _renderTargetSpecification.height > 0; }
     Camera* CameraComponent::getSource() { return &_camera; }
+    const CameraRenderTargetSpecification& CameraComponent::getRenderTargetSpecification() const noexcept { return _renderTargetSpecification; }
+    const glm::vec4& CameraComponent::getViewport() const noexcept { return _viewport; }
+    RenderPath CameraComponent::getRenderPath() const noexcept { return _renderPath; }
 }
\ No newline at end of file
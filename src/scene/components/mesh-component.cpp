@@ -1,4 +1,5 @@
 #include "scene/components/mesh-component.hpp"
+#include "scene/asset-manager.hpp"
 
 namespace TWE {
     MeshComponent::MeshComponent(GLfloat* vertices, GLsizei vertSize, GLuint* indices, GLsizei indSize, const std::string& registryId, 
@@ -15,21 +16,33 @@ namespace TWE {
         _texture = std::make_shared<Texture>(*texture);
     }
 
+    MeshComponent::MeshComponent(GLfloat* vertices, GLsizei vertSize, void* indices, GLsizei indSize, GLenum indexType, const VertexLayout& layout, 
+        const std::string& registryId, const ModelMeshSpecification& modelSpec, const TextureAttachmentSpecification& textureAtttachments, bool ownsData)
+    : _registryId(registryId), _modelSpec(modelSpec) {
+        create(vertices, vertSize, indices, indSize, indexType, layout, ownsData);
+        _texture = std::make_shared<Texture>(textureAtttachments);
+        acquireAssetReference();
+    }
+
     MeshComponent::MeshComponent(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const std::string& registryId, 
         const ModelMeshSpecification& modelSpec, const TextureAttachmentSpecification& textureAtttachments)
     : _vao(vao), _vbo(vbo), _ebo(ebo), _registryId(registryId), _modelSpec(modelSpec) {
         _texture = std::make_shared<Texture>(textureAtttachments);
+        acquireAssetReference();
     }
 
     MeshComponent::MeshComponent(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const std::string& registryId, 
         const ModelMeshSpecification& modelSpec, Texture* texture)
     : _vao(vao), _vbo(vbo), _ebo(ebo), _registryId(registryId), _modelSpec(modelSpec) {
         _texture = std::make_shared<Texture>(*texture);
+        acquireAssetReference();
     }
 
     MeshComponent::MeshComponent(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const std::string& registryId, 
         const ModelMeshSpecification& modelSpec, std::shared_ptr<Texture> texture) 
-     : _vao(vao), _vbo(vbo), _ebo(ebo), _registryId(registryId), _texture(texture), _modelSpec(modelSpec) {}
+     : _vao(vao), _vbo(vbo), _ebo(ebo), _registryId(registryId), _texture(texture), _modelSpec(modelSpec) {
+        acquireAssetReference();
+    }
 
     MeshComponent::MeshComponent(const MeshComponent& mesh) {
         this->_vao = mesh._vao;
@@ -38,6 +51,10 @@ namespace TWE {
         this->_texture = mesh._texture;
         this->_registryId = mesh._registryId;
         this->_modelSpec = mesh._modelSpec;
+        this->_lodChain = mesh._lodChain;
+        this->_assetReference = mesh._assetReference;
+        this->_lodIndex = mesh._lodIndex;
+        this->_isLODChainResolved = mesh._isLODChainResolved;
     }
 
     void MeshComponent::setMesh(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, const std::string& registryId, const ModelMeshSpecification& modelSpec) {
@@ -46,6 +63,10 @@ namespace TWE {
         this->_ebo = ebo;
         this->_registryId = registryId;
         this->_modelSpec = modelSpec;
+        this->_lodChain = nullptr;
+        this->_lodIndex = 0;
+        this->_isLODChainResolved = false;
+        acquireAssetReference();
     }
 
     void MeshComponent::setTexture(const TextureAttachmentSpecification& textureAtttachments) {
@@ -60,19 +81,38 @@ namespace TWE {
         _texture = texture;
     }
 
-    void MeshComponent::create(GLfloat* vertices, GLsizei vertSize, GLuint* indices, GLsizei indSize) {
-        _vao = std::make_shared<VAO>();
-        _vao->bind();
-        _vbo = std::make_shared<VBO>(vertices, vertSize, GL_STATIC_DRAW);
-        _vbo->bind();
-        _ebo = std::make_shared<EBO>(indices, indSize, GL_STATIC_DRAW);
-        _ebo->bind();
-        _vao->setAttrib(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0, *_vbo.get());
-        _vao->setAttrib(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)), *_vbo.get());
-        _vao->setAttrib(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)), *_vbo.get());
-        _vao->unbind();
-        _vbo->unbind();
-        _ebo->unbind();
+    void MeshComponent::setLODChain(std::shared_ptr<MeshLODChainSpecification> lodChain) {
+        _lodChain = lodChain;
+        _lodIndex = 0;
+        _isLODChainResolved = true;
+    }
+
+    void MeshComponent::setLODIndex(int lodIndex) {
+        _lodIndex = lodIndex;
+    }
+
+    void MeshComponent::create(GLfloat* vertices, GLsizei vertSize, void* indices, GLsizei indSize, GLenum indexType, const VertexLayout& layout, bool ownsData) {
+        auto createBuffers = [&]() {
+            _vao = std::make_shared<VAO>();
+            _vao->bind();
+            _vbo = std::make_shared<VBO>(vertices, vertSize, GL_STATIC_DRAW, layout, ownsData);
+            _vbo->bind();
+            _ebo = std::make_shared<EBO>(indices, indSize, GL_STATIC_DRAW, indexType, ownsData);
+            _ebo->bind();
+            _vao->setLayout(_vbo->getLayout(), *_vbo.get());
+            _vao->unbind();
+            _vbo->unbind();
+            _ebo->unbind();
+        };
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        JobSystem::runOnMainThread(createBuffers);
+        #else
+        createBuffers();
+        #endif
+    }
+
+    void MeshComponent::acquireAssetReference() {
+        _assetReference = _modelSpec.isModel ? AssetManager::acquire(_modelSpec.modelPath) : nullptr;
     }
 
     std::shared_ptr<VAO> MeshComponent::getVAO() const noexcept { return _vao; }
@@ -81,4 +121,7 @@ namespace TWE {
     std::shared_ptr<Texture> MeshComponent::getTexture() const noexcept { return _texture; }
     const std::string& MeshComponent::getRegistryId() const noexcept { return _registryId; }
     const ModelMeshSpecification& MeshComponent::getModelMeshSpecification() const noexcept { return _modelSpec; }
+    std::shared_ptr<MeshLODChainSpecification> MeshComponent::getLODChain() const noexcept { return _lodChain; }
+    int MeshComponent::getLODIndex() const noexcept { return _lodIndex; }
+    bool MeshComponent::getIsLODChainResolved() const noexcept { return _isLODChainResolved; }
 }
\ No newline at end of file
@@ -5,23 +5,22 @@ namespace TWE {
 
     MeshRendererComponent::MeshRendererComponent(const char* vertexShaderPath, const char* fragmentShaderPath, int entityId, const std::string& registryId)
     : _registryId(registryId), _entityId(entityId) {
-        _shader = std::make_shared<Shader>(vertexShaderPath, fragmentShaderPath);
-        _shader->setUniform("id", entityId);
+        createShader(vertexShaderPath, fragmentShaderPath);
         _is3D = true;
     }
 
     MeshRendererComponent::MeshRendererComponent(const MeshRendererComponent& meshRendererComponent) {
         this->_material = meshRendererComponent._material;
         this->_shader = meshRendererComponent._shader;
+        this->_uniforms = meshRendererComponent._uniforms;
         this->_registryId = meshRendererComponent._registryId;
         this->_entityId = meshRendererComponent._entityId;
         this->_is3D = meshRendererComponent._is3D;
     }
 
     void MeshRendererComponent::setShader(const char* vertexShaderPath, const char* fragmentShaderPath, const std::string& registryId) {
-        _shader = std::make_shared<Shader>(vertexShaderPath, fragmentShaderPath);
+        createShader(vertexShaderPath, fragmentShaderPath);
         _registryId = registryId;
-        _shader->setUniform("id", _entityId);
     }
 
     void MeshRendererComponent::setShader(std::shared_ptr<Shader> shader) {
@@ -36,19 +35,27 @@ namespace TWE {
         _is3D = is3D;
     }
 
-    void MeshRendererComponent::updateMatsUniform(const glm::mat4& model, const glm::mat4& view, const glm::mat4& projection, const glm::mat4& projectionView) {
-        _shader->setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::MODEL], model);
-        _shader->setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::VIEW], view);
-        _shader->setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::PROJECTION], projection);
-        _shader->setUniform(TRANS_MAT_OPTIONS[TransformMatrixOptions::MVP], projectionView * model);
+    void MeshRendererComponent::setUniform(const std::string& name, const ShaderUniformValue& value) {
+        auto uniforms = _uniforms ? std::make_shared<std::vector<ShaderUniformSpecification>>(*_uniforms) 
+            : std::make_shared<std::vector<ShaderUniformSpecification>>();
+        auto it = std::find_if(uniforms->begin(), uniforms->end(), [&](const ShaderUniformSpecification& uniform) { return uniform.name == name; });
+        if(it != uniforms->end())
+            it->value = value;
+        else
+            uniforms->emplace_back(name, value);
+        _uniforms = uniforms;
     }
 
-    void MeshRendererComponent::updateMaterialUniform() {
-        _shader->setUniform("material.objColor", _material.objColor);
-        _shader->setUniform("material.ambient", _material.ambient);
-        _shader->setUniform("material.diffuse", _material.diffuse);
-        _shader->setUniform("material.specular", _material.specular);
-        _shader->setUniform("material.shininess", _material.shininess);
+    void MeshRendererComponent::createShader(const char* vertexShaderPath, const char* fragmentShaderPath) {
+        auto create = [&]() {
+            _shader = std::make_shared<Shader>(vertexShaderPath, fragmentShaderPath);
+            _shader->setUniform("id", _entityId);
+        };
+        #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+        JobSystem::runOnMainThread(create);
+        #else
+        create();
+        #endif
     }
 
     int MeshRendererComponent::getEntityId() const noexcept { return _entityId; }
@@ -56,4 +63,5 @@ namespace TWE {
     Material& MeshRendererComponent::getMaterial() noexcept { return _material; }
     std::shared_ptr<Shader> MeshRendererComponent::getShader() const noexcept { return _shader; }
     const std::string& MeshRendererComponent::getRegistryId() const noexcept { return _registryId; }
+    std::shared_ptr<const std::vector<ShaderUniformSpecification>> MeshRendererComponent::getUniforms() const noexcept { return _uniforms; }
 }
\ No newline at end of file
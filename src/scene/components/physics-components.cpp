@@ -1,6 +1,9 @@
 #include "scene/components/physics-components.hpp"
 
 namespace TWE {
+    std::map<std::tuple<const VBO*, const EBO*, int, int>, TriangleMeshShapeSpecification>* PhysicsComponent::triangleMeshShapes 
+        = new std::map<std::tuple<const VBO*, const EBO*, int, int>, TriangleMeshShapeSpecification>();
+
     PhysicsComponent::PhysicsComponent(): _colliderType(ColliderType::None), _needUpdate(true) {}
 
     PhysicsComponent::PhysicsComponent(btDynamicsWorld* dynamicsWorld, ColliderType colliderType, const glm::vec3& shapeSize, 
@@ -188,17 +191,40 @@ namespace TWE {
     }
 
     btCollisionShape* PhysicsComponent::createShape(ColliderType colliderType, TriangleMeshSpecification& triangleMeshSpecification) {
-        btTriangleIndexVertexArray* triangleMesh;
-        int numTriangles = triangleMeshSpecification.ebo->getSize() / sizeof(int) / 3;
-        if(numTriangles >= 100000)
-            return nullptr;
-        int* triangleIndexBase = (int*)triangleMeshSpecification.ebo->getIndices();
-        int triangleIndexStride = 3 * sizeof(int);
-        int numVertices = triangleMeshSpecification.vbo->getSize() / sizeof(float) / 8;
-        btScalar* vertexBase = triangleMeshSpecification.vbo->getVertices();
-        int vertexStride = 8 * sizeof(float);
-        triangleMesh = new btTriangleIndexVertexArray(numTriangles, triangleIndexBase, triangleIndexStride, numVertices, vertexBase, vertexStride);
-        return new btBvhTriangleMeshShape(triangleMesh, false);
+        auto& ebo = triangleMeshSpecification.ebo;
+        auto& vbo = triangleMeshSpecification.vbo;
+        auto& submesh = triangleMeshSpecification.submesh;
+        std::tuple<const VBO*, const EBO*, int, int> key(vbo.get(), ebo.get(), submesh.indexOffset, submesh.indexCount);
+        releaseExpiredTriangleMeshShapes();
+        auto triangleMeshShape = triangleMeshShapes->find(key);
+        if(triangleMeshShape == triangleMeshShapes->end()) {
+            btIndexedMesh indexedMesh;
+            indexedMesh.m_numTriangles = (submesh.isValid() ? submesh.indexCount : ebo->getCount()) / 3;
+            if(indexedMesh.m_numTriangles >= 100000)
+                return nullptr;
+            indexedMesh.m_triangleIndexBase = static_cast<const unsigned char*>(ebo->getData()) + submesh.indexOffset * ebo->getIndexSize();
+            indexedMesh.m_triangleIndexStride = 3 * ebo->getIndexSize();
+            indexedMesh.m_indexType = ebo->getIndexType() == GL_UNSIGNED_SHORT ? PHY_SHORT : PHY_INTEGER;
+            indexedMesh.m_numVertices = submesh.isValid() ? submesh.vertexCount : vbo->getVertexCount();
+            indexedMesh.m_vertexBase = reinterpret_cast<const unsigned char*>(vbo->getPositions() + submesh.baseVertex * 3);
+            indexedMesh.m_vertexStride = 3 * sizeof(float);
+            btTriangleIndexVertexArray* triangleMesh = new btTriangleIndexVertexArray();
+            triangleMesh->addIndexedMesh(indexedMesh, indexedMesh.m_indexType);
+            triangleMeshShape = triangleMeshShapes->emplace(key, TriangleMeshShapeSpecification{ vbo, ebo, new btBvhTriangleMeshShape(triangleMesh, false) }).first;
+        }
+        return new btScaledBvhTriangleMeshShape(triangleMeshShape->second.shape, {1.f, 1.f, 1.f});
+    }
+
+    void PhysicsComponent::releaseExpiredTriangleMeshShapes() {
+        for(auto it = triangleMeshShapes->begin(); it != triangleMeshShapes->end();) {
+            if(!it->second.vbo.expired() && !it->second.ebo.expired()) {
+                ++it;
+                continue;
+            }
+            delete it->second.shape->getMeshInterface();
+            delete it->second.shape;
+            it = triangleMeshShapes->erase(it);
+        }
     }
 
     void PhysicsComponent::setNeedUpdate(bool needUpdate) {
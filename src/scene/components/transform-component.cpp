@@ -1,75 +1,112 @@
 #include "scene/components/transform-component.hpp"
 
 namespace TWE {
-    TransformComponent::TransformComponent(): _needRecache(true) {}
+    TransformComponent::TransformComponent()
+        : _orientation(1.f, 0.f, 0.f, 0.f), _preOrientation(1.f, 0.f, 0.f, 0.f), _needRecache(true), _needEulerUpdate(false), _isDirty(true), _keepChilds(false),
+        _localModel(1.f), _parent(entt::null) {}
 
     TransformComponent::TransformComponent(const TransformComponent& transform) {
         this->_transform = transform._transform;
         this->_preTransform = transform._preTransform;
         this->_model = transform._model;
+        this->_orientation = transform._orientation;
+        this->_preOrientation = transform._preOrientation;
         this->_needRecache = transform._needRecache;
+        this->_needEulerUpdate = transform._needEulerUpdate;
+        this->_isDirty = transform._isDirty;
+        this->_keepChilds = transform._keepChilds;
+        this->_localModel = transform._localModel;
+        this->_parent = transform._parent;
     }
 
     void TransformComponent::move(const glm::vec3& pos, bool acceptToChilds) {
         auto model = glm::translate(getModel(), pos / _transform.size);
         _transform.position = model[3];
-        if(!acceptToChilds)
+        if(!acceptToChilds) {
             _preTransform.position = _transform.position;
+            _keepChilds = true;
+        }
         _needRecache = true;
+        _isDirty = true;
     }
 
     void TransformComponent::rotate(float angle, const glm::vec3& axis, bool acceptToChilds) {
-        setRotation({ _transform.rotation.x + (axis.x * (angle * PI / 180.f)), 
-                      _transform.rotation.y + (axis.y * (angle * PI / 180.f)),
-                      _transform.rotation.z + (axis.z * (angle * PI / 180.f)) }, acceptToChilds);
+        auto& rotation = getRotation();
+        setRotation({ rotation.x + (axis.x * (angle * PI / 180.f)), 
+                      rotation.y + (axis.y * (angle * PI / 180.f)),
+                      rotation.z + (axis.z * (angle * PI / 180.f)) }, acceptToChilds);
     }
 
     void TransformComponent::scale(const glm::vec3& size, bool acceptToChilds) {
         _transform.size *= size;
-        if(!acceptToChilds)
+        if(!acceptToChilds) {
             _preTransform.size = _transform.size;
+            _keepChilds = true;
+        }
         _needRecache = true;
+        _isDirty = true;
     }
 
     void TransformComponent::setPosition(const glm::vec3& pos, bool acceptToChilds) {
         _transform.position = pos;
-        if(!acceptToChilds)
+        if(!acceptToChilds) {
             _preTransform.position = _transform.position;
+            _keepChilds = true;
+        }
         _needRecache = true;
+        _isDirty = true;
     }
 
     void TransformComponent::setRotation(float angle, const glm::vec3& axis, bool acceptToChilds) {
-        _transform.rotation = glm::eulerAngles(glm::angleAxis(angle, axis)) * PI / 180.f;
-        if(!acceptToChilds)
-            _preTransform.rotation = _transform.rotation;
-        _needRecache = true;
+        setRotation(glm::eulerAngles(glm::angleAxis(angle, axis)) * PI / 180.f, acceptToChilds);
     }
 
     void TransformComponent::setRotation(const glm::vec3& angles, bool acceptToChilds) {
         _transform.rotation = angles;
-        if(!acceptToChilds)
+        _orientation = glm::quat(angles);
+        _needEulerUpdate = false;
+        if(!acceptToChilds) {
             _preTransform.rotation = _transform.rotation;
+            _preOrientation = _orientation;
+            _keepChilds = true;
+        }
+        _needRecache = true;
+        _isDirty = true;
+    }
+
+    void TransformComponent::setOrientation(const glm::quat& orientation, bool acceptToChilds) {
+        _orientation = orientation;
+        _needEulerUpdate = true;
+        if(!acceptToChilds) {
+            _preOrientation = _orientation;
+            _keepChilds = true;
+        }
         _needRecache = true;
+        _isDirty = true;
     }
 
     void TransformComponent::rotateAroundOrigin(const glm::vec3& angles, const glm::vec3& centerPosition, bool acceptToChilds) {
         glm::vec3 zeroPos = getZeroRotationAroundPos(centerPosition);
-        _transform.rotation += angles;
+        _transform.rotation = getRotation() + angles;
+        _orientation = glm::quat(_transform.rotation);
         auto translate1 = glm::translate(glm::mat4(1.f), -centerPosition);
-        auto rotation = glm::toMat4(glm::quat(_transform.rotation));
+        auto rotation = glm::toMat4(_orientation);
         auto translate2 = glm::translate(glm::mat4(1.f), centerPosition);
         auto transform = translate2 * rotation * translate1;
         _transform.position = transform * glm::vec4(zeroPos, 1.f);
         if(!acceptToChilds) {
             _preTransform.rotation = _transform.rotation;
             _preTransform.position = _transform.position;
+            _preOrientation = _orientation;
+            _keepChilds = true;
         }
         _needRecache = true;
+        _isDirty = true;
     }
 
     glm::vec3 TransformComponent::getZeroRotationAroundPos(const glm::vec3& centerPosition) {
         auto translate1 = glm::translate(glm::mat4(1.f), -centerPosition);
-        auto rotation = glm::inverse(glm::toMat4(glm::quat(_transform.rotation)));
+        auto rotation = glm::inverse(glm::toMat4(_orientation));
         auto translate2 = glm::translate(glm::mat4(1.f), centerPosition);
         auto transform = translate2 * rotation * translate1;
         return transform * glm::vec4(_transform.position, 1.f);
@@ -77,24 +114,35 @@ namespace TWE {
 
     void TransformComponent::setSize(const glm::vec3& size, bool acceptToChilds) {
         _transform.size = size;
-        if(!acceptToChilds)
+        if(!acceptToChilds) {
             _preTransform.size = _transform.size;
+            _keepChilds = true;
+        }
         _needRecache = true;
+        _isDirty = true;
     }
 
     glm::mat4 TransformComponent::getModel() {
         if(_needRecache) {
             _model = glm::translate(glm::mat4(1.f), _transform.position)
-                  * glm::toMat4(glm::quat(_transform.rotation))
+                  * glm::toMat4(_orientation)
                   * glm::scale(glm::mat4(1.f), _transform.size);
             _needRecache = false;
         }
         return _model;
     }
 
-    const ModelSpecification& TransformComponent::getTransform() const noexcept { return _transform; }
+    void TransformComponent::updateEuler() const noexcept {
+        if(!_needEulerUpdate)
+            return;
+        _transform.rotation = glm::eulerAngles(_orientation);
+        _needEulerUpdate = false;
+    }
+
+    const ModelSpecification& TransformComponent::getTransform() const noexcept { updateEuler(); return _transform; }
     const glm::vec3& TransformComponent::getPosition() const noexcept { return _transform.position; }
-    const glm::vec3& TransformComponent::getRotation() const noexcept { return _transform.rotation; }
+    const glm::vec3& TransformComponent::getRotation() const noexcept { updateEuler(); return _transform.rotation; }
+    const glm::quat& TransformComponent::getOrientation() const noexcept { return _orientation; }
     const glm::vec3& TransformComponent::getSize() const noexcept { return _transform.size; }
     glm::vec3 TransformComponent::getForward() { return glm::normalize(glm::vec3(getModel()[2])); }
     glm::vec3 TransformComponent::getRight() { return glm::normalize(glm::vec3(getModel()[0])); }
@@ -102,6 +150,33 @@ namespace TWE {
 
     void TransformComponent::setPreTransform(const ModelSpecification& preTransform) {
         _preTransform = preTransform;
+        _preOrientation = glm::quat(preTransform.rotation);
+        _isDirty = false;
+    }
+
+    void TransformComponent::commitTransform() {
+        _preTransform.position = _transform.position;
+        _preTransform.size = _transform.size;
+        _preOrientation = _orientation;
+        _isDirty = false;
+    }
+
+    void TransformComponent::setWorldModel(const glm::mat4& model) {
+        glm::vec3 size(glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2])));
+        glm::vec3 axisSize = glm::max(size, glm::vec3(0.000001f));
+        glm::mat3 rotation(glm::vec3(model[0]) / axisSize.x, glm::vec3(model[1]) / axisSize.y, glm::vec3(model[2]) / axisSize.z);
+        _transform.position = glm::vec3(model[3]);
+        _transform.size = size;
+        _orientation = glm::quat_cast(rotation);
+        _needEulerUpdate = true;
+        _model = model;
+        _needRecache = false;
+        commitTransform();
+    }
+
+    void TransformComponent::setLocalModel(const glm::mat4& parentModel, entt::entity parent) {
+        _localModel = glm::inverse(parentModel) * getModel();
+        _parent = parent;
     }
 
     const ModelSpecification& TransformComponent::getPreTransform() const noexcept { return _preTransform; }
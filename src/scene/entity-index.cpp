@@ -0,0 +1,139 @@
+#include "scene/entity-index.hpp"
+
+namespace TWE {
+    EntityIndex::~EntityIndex() {
+        disconnect();
+    }
+
+    void EntityIndex::connect(entt::registry& registry) {
+        disconnect();
+        _registry = &registry;
+        registry.on_construct<IDComponent>().connect<&EntityIndex::onConstructID>(*this);
+        registry.on_update<IDComponent>().connect<&EntityIndex::onUpdateID>(*this);
+        registry.on_destroy<IDComponent>().connect<&EntityIndex::onDestroyID>(*this);
+        registry.on_construct<NameComponent>().connect<&EntityIndex::onConstructName>(*this);
+        registry.on_update<NameComponent>().connect<&EntityIndex::onUpdateName>(*this);
+        registry.on_destroy<NameComponent>().connect<&EntityIndex::onDestroyName>(*this);
+        rebuild();
+    }
+
+    void EntityIndex::disconnect() {
+        if(!_registry)
+            return;
+        _registry->on_construct<IDComponent>().disconnect<&EntityIndex::onConstructID>(*this);
+        _registry->on_update<IDComponent>().disconnect<&EntityIndex::onUpdateID>(*this);
+        _registry->on_destroy<IDComponent>().disconnect<&EntityIndex::onDestroyID>(*this);
+        _registry->on_construct<NameComponent>().disconnect<&EntityIndex::onConstructName>(*this);
+        _registry->on_update<NameComponent>().disconnect<&EntityIndex::onUpdateName>(*this);
+        _registry->on_destroy<NameComponent>().disconnect<&EntityIndex::onDestroyName>(*this);
+        _registry = nullptr;
+        _ids.clear();
+        _entityIds.clear();
+        _names.clear();
+        _entityNames.clear();
+    }
+
+    void EntityIndex::rebuild() {
+        _ids.clear();
+        _entityIds.clear();
+        if(!_registry)
+            return;
+        _ids.reserve(_registry->view<IDComponent>().size());
+        _entityIds.reserve(_registry->view<IDComponent>().size());
+        _registry->view<IDComponent>().each([&](entt::entity entity, IDComponent& idComponent) {
+            _ids[idComponent.id] = entity;
+            _entityIds[entity] = idComponent.id;
+        });
+        rebuildNames();
+    }
+
+    entt::entity EntityIndex::findById(int id) {
+        auto it = _ids.find(id);
+        if(it == _ids.end())
+            return entt::null;
+        entt::entity entity = it->second;
+        if(!_registry->valid(entity) || !_registry->any_of<IDComponent>(entity) || _registry->get<IDComponent>(entity).id != id)
+            return entt::null;
+        return entity;
+    }
+
+    entt::entity EntityIndex::findByName(const std::string& name) {
+        auto entities = findAllByName(name);
+        return entities.empty() ? entt::null : entities.front();
+    }
+
+    std::vector<entt::entity> EntityIndex::findAllByName(const std::string& name) {
+        std::vector<entt::entity> res;
+        if(!_registry)
+            return res;
+        auto [begin, end] = _names.equal_range(name);
+        for(auto it = begin; it != end; ++it)
+            if(_registry->valid(it->second) && _registry->any_of<NameComponent>(it->second) && _registry->get<NameComponent>(it->second).getName() == name)
+                res.push_back(it->second);
+        return res;
+    }
+
+    void EntityIndex::rebuildNames() {
+        _names.clear();
+        _entityNames.clear();
+        _names.reserve(_registry->view<NameComponent>().size());
+        _entityNames.reserve(_registry->view<NameComponent>().size());
+        _registry->view<NameComponent>().each([&](entt::entity entity, NameComponent& nameComponent) {
+            _names.emplace(nameComponent.getName(), entity);
+            _entityNames[entity] = nameComponent.getName();
+        });
+    }
+
+    void EntityIndex::onConstructID(entt::registry& registry, entt::entity entity) {
+        int id = registry.get<IDComponent>(entity).id;
+        _ids[id] = entity;
+        _entityIds[entity] = id;
+    }
+
+    void EntityIndex::onUpdateID(entt::registry& registry, entt::entity entity) {
+        eraseID(entity);
+        onConstructID(registry, entity);
+    }
+
+    void EntityIndex::onDestroyID(entt::registry& registry, entt::entity entity) {
+        eraseID(entity);
+    }
+
+    void EntityIndex::eraseID(entt::entity entity) {
+        auto id = _entityIds.find(entity);
+        if(id == _entityIds.end())
+            return;
+        auto it = _ids.find(id->second);
+        if(it != _ids.end() && it->second == entity)
+            _ids.erase(it);
+        _entityIds.erase(id);
+    }
+
+    void EntityIndex::onConstructName(entt::registry& registry, entt::entity entity) {
+        auto name = registry.get<NameComponent>(entity).getName();
+        _names.emplace(name, entity);
+        _entityNames[entity] = name;
+    }
+
+    void EntityIndex::onUpdateName(entt::registry& registry, entt::entity entity) {
+        eraseName(entity);
+        onConstructName(registry, entity);
+    }
+
+    void EntityIndex::onDestroyName(entt::registry& registry, entt::entity entity) {
+        eraseName(entity);
+    }
+
+    void EntityIndex::eraseName(entt::entity entity) {
+        auto name = _entityNames.find(entity);
+        if(name == _entityNames.end())
+            return;
+        auto [begin, end] = _names.equal_range(name->second);
+        for(auto it = begin; it != end; ++it)
+            if(it->second == entity) {
+                _names.erase(it);
+                break;
+            }
+        _entityNames.erase(name);
+    }
+}
\ No newline at end of file
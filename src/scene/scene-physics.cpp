@@ -33,9 +33,7 @@ namespace TWE {
             btVector3 pos = worldTransform.getOrigin();
             btQuaternion quat = worldTransform.getRotation();
             transformComponent.setPosition(glm::vec3(pos.getX(), pos.getY(), pos.getZ()));
-            glm::vec3 rot;
-            quat.getEulerZYX(rot.z, rot.y, rot.x);
-            transformComponent.setRotation(rot);
+            transformComponent.setOrientation(glm::quat(quat.getW(), quat.getX(), quat.getY(), quat.getZ()));
             physicsComponent.setNeedUpdate(false);
         });
         _world->stepSimulation(deltaTime);
@@ -1,6 +1,8 @@
 #include "scene/scene-serializer.hpp"
 
 namespace TWE {
+    std::map<std::string, std::filesystem::file_time_type> SceneSerializer::writeTimes;
+
     bool SceneSerializer::serialize(IScene* scene, const std::string& path, ProjectData* projectData) {
         if(scene->getSceneState() != SceneState::Edit)
             return false;
@@ -8,6 +10,7 @@ namespace TWE {
         std::string sceneName = std::filesystem::path(path).stem().string();
         scene->setName(sceneName);
         jsonMain["Scene"] = sceneName;
+        jsonMain["RenderPath"] = scene->getRenderPath();
         nlohmann::json jsonEntities = nlohmann::json::array();
         auto& view = scene->getSceneRegistry()->edit.entityRegistry.view<NameComponent>();
         int size = view.size();
@@ -18,9 +21,26 @@ namespace TWE {
         }
         jsonMain["Entities"] = jsonEntities;
         File::save(path.c_str(), jsonMain.dump());
+        std::error_code error;
+        auto writeTime = std::filesystem::last_write_time(path, error);
+        if(!error)
+            writeTimes[getWriteTimeKey(path)] = writeTime;
         return true;
     }
 
+    bool SceneSerializer::isModifiedExternally(const std::string& path) {
+        std::error_code error;
+        auto writeTime = std::filesystem::last_write_time(path, error);
+        if(error)
+            return false;
+        auto recordedWriteTime = writeTimes.find(getWriteTimeKey(path));
+        return recordedWriteTime == writeTimes.end() || recordedWriteTime->second != writeTime;
+    }
+
+    std::string SceneSerializer::getWriteTimeKey(const std::string& path) {
+        return std::filesystem::absolute(path).lexically_normal().string();
+    }
+
     bool SceneSerializer::deserialize(IScene* scene, const std::string& path, ProjectData* projectData) {
         std::string jsonBodyStr = File::getBody(path.c_str());
         nlohmann::json jsonMain = nlohmann::json::parse(jsonBodyStr);
@@ -28,7 +48,16 @@ namespace TWE {
             return false;
         scene->reset();
         scene->setName(jsonMain["Scene"]);
+        if(jsonMain.contains("RenderPath"))
+            scene->setRenderPath(static_cast<RenderPath>(jsonMain["RenderPath"]));
         auto& entities = jsonMain["Entities"].items();
+        std::vector<std::filesystem::path> modelPaths;
+        for(auto& [index, components] : entities) {
+            auto jsonMeshComponent = components.find("MeshComponent");
+            if(jsonMeshComponent != components.end() && jsonMeshComponent->contains("IsModel") && (bool)(*jsonMeshComponent)["IsModel"])
+                modelPaths.push_back(projectData->rootPath / (std::string)(*jsonMeshComponent)["ModelPath"]);
+        }
+        Shape::registerModels(modelPaths);
         for(auto& [index, components] : entities) {        
             Entity instance = deserializeCreationTypeComponent(scene, components, projectData->rootPath);
             if(instance.getSource() != entt::null)
@@ -40,36 +69,27 @@ namespace TWE {
 
     void SceneSerializer::revalidateParentChildsComponent(IScene* scene) {
         int lastId = -1;
-        std::map<entt::entity, ParentChildsComponent> newParentChilds;
-        auto sceneRegistry = scene->getSceneRegistry(); 
-        sceneRegistry->edit.entityRegistry.view<ParentChildsComponent>().each([&](entt::entity entityOut, ParentChildsComponent& parentChildsComponent){
-            Entity outInstance = { entityOut, scene };
+        auto& editState = scene->getSceneRegistry()->edit;
+        auto& registry = editState.entityRegistry;
+        auto& entityIndex = editState.entityIndex;
+        entityIndex.rebuild();
+        registry.view<IDComponent>().each([&](entt::entity entity, IDComponent& idComponent) {
+            if(idComponent.id > lastId)
+                lastId = idComponent.id;
+        });
+        registry.view<ParentChildsComponent>().each([&](entt::entity entity, ParentChildsComponent& parentChildsComponent) {
+            entt::entity parent = parentChildsComponent.parent == entt::null ? entt::null : entityIndex.findById(static_cast<int>(parentChildsComponent.parent));
+            parentChildsComponent.parent = parent == entity ? entt::null : parent;
             std::vector<entt::entity> childs;
-            entt::entity parent = entt::null;
-            sceneRegistry->edit.entityRegistry.view<IDComponent>().each([&](entt::entity entityIn, IDComponent& idComponent) {
-                if(idComponent.id > lastId)
-                    lastId = idComponent.id;
-                if(entityOut == entityIn)
-                    return;
-                if(parentChildsComponent.parent == (entt::entity)idComponent.id) {
-                    parent = entityIn;
-                    return;
-                }
-                for(auto childId : parentChildsComponent.childs)
-                    if(childId == (entt::entity)idComponent.id) {
-                        childs.push_back(entityIn);
-                        return;
-                    }
-            });
-            newParentChilds.insert({entityOut, ParentChildsComponent{parent, childs}});
+            childs.reserve(parentChildsComponent.childs.size());
+            for(auto childId : parentChildsComponent.childs) {
+                entt::entity child = entityIndex.findById(static_cast<int>(childId));
+                if(child != entt::null && child != entity)
+                    childs.push_back(child);
+            }
+            parentChildsComponent.childs = std::move(childs);
         });
-        sceneRegistry->edit.lastId = ++lastId;
-        for(auto [entity, parentChilds] : newParentChilds) {
-            Entity instance = { entity, scene };
-            auto& parentChildsComponent = instance.getComponent<ParentChildsComponent>();
-            parentChildsComponent.parent = parentChilds.parent;
-            parentChildsComponent.childs = parentChilds.childs;
-        }
+        editState.lastId = ++lastId;
     }
 
     void SceneSerializer::serializeEntity(Entity& entity, nlohmann::json& jsonEntities, ProjectData* projectData, IScene* scene) {
@@ -216,6 +236,7 @@ namespace TWE {
             entity.addComponent<NameComponent>();
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName(name);
+        entity.patchComponent<NameComponent>();
     }
 
     void SceneSerializer::serializeTransformComponent(Entity& entity, nlohmann::json& jsonEntity) {
@@ -399,6 +420,23 @@ namespace TWE {
         jsonOrthographicSpecification["Far"] = orthographicSpecification.farDepth;
         jsonCameraComponent["OrthographicSpecification"] = jsonOrthographicSpecification;
 
+        auto& renderTargetSpecification = cameraComponent.getRenderTargetSpecification();
+        nlohmann::json jsonRenderTargetSpecification;
+        jsonRenderTargetSpecification["Width"] = renderTargetSpecification.width;
+        jsonRenderTargetSpecification["Height"] = renderTargetSpecification.height;
+        jsonRenderTargetSpecification["UpdateMode"] = renderTargetSpecification.updateMode;
+        jsonRenderTargetSpecification["UpdateInterval"] = renderTargetSpecification.updateInterval;
+        jsonCameraComponent["RenderTargetSpecification"] = jsonRenderTargetSpecification;
+
+        nlohmann::json jsonViewport = nlohmann::json::array();
+        auto& viewport = cameraComponent.getViewport();
+        jsonViewport.push_back(viewport.x);
+        jsonViewport.push_back(viewport.y);
+        jsonViewport.push_back(viewport.z);
+        jsonViewport.push_back(viewport.w);
+        jsonCameraComponent["Viewport"] = jsonViewport;
+        jsonCameraComponent["RenderPath"] = cameraComponent.getRenderPath();
+
         jsonEntity["CameraComponent"] = jsonCameraComponent;
     }
 
@@ -411,6 +449,22 @@ namespace TWE {
         Camera* cameraSouce = cameraComponent.getSource();
 
         cameraComponent.setFocuse(jsonComponent["IsFocusedOn"]);
+        if(jsonComponent.contains("RenderTargetSpecification")) {
+            nlohmann::json jsonRenderTargetSpecification = jsonComponent["RenderTargetSpecification"];
+            CameraRenderTargetSpecification renderTargetSpecification;
+            renderTargetSpecification.width = jsonRenderTargetSpecification["Width"];
+            renderTargetSpecification.height = jsonRenderTargetSpecification["Height"];
+            renderTargetSpecification.updateMode = static_cast<CameraUpdateMode>(jsonRenderTargetSpecification["UpdateMode"]);
+            renderTargetSpecification.updateInterval = jsonRenderTargetSpecification["UpdateInterval"];
+            cameraComponent.setRenderTargetSpecification(renderTargetSpecification);
+        }
+        if(jsonComponent.contains("Viewport")) {
+            nlohmann::json jsonViewport = jsonComponent["Viewport"];
+            glm::vec4 viewport = {jsonViewport[0], jsonViewport[1], jsonViewport[2], jsonViewport[3]};
+            cameraComponent.setViewport(viewport);
+        }
+        if(jsonComponent.contains("RenderPath"))
+            cameraComponent.setRenderPath(static_cast<RenderPath>(jsonComponent["RenderPath"]));
         
         nlohmann::json jsonPerspectiveSpecification = jsonComponent["PerspectiveSpecification"];
         nlohmann::json jsonOrthographicSpecification = jsonComponent["OrthographicSpecification"];
@@ -568,7 +622,7 @@ namespace TWE {
         }
         else {
             auto& meshComponent = entity.getComponent<MeshComponent>();
-            TriangleMeshSpecification triangleMesh = { meshComponent.getVBO(), meshComponent.getEBO() };
+            TriangleMeshSpecification triangleMesh = { meshComponent.getVBO(), meshComponent.getEBO(), meshComponent.getModelMeshSpecification().submesh };
             auto& physicsComponent = entity.addComponent<PhysicsComponent>(scene->getDynamicWorld(), type, triangleMesh, localScale, position, rotation, entity.getSource());
             physicsComponent.setIsTrigger(isTrigger);
         }
@@ -657,6 +711,7 @@ namespace TWE {
             return;
         auto& idComponent = entity.getComponent<IDComponent>();
         idComponent.id = jsonComponent;
+        entity.patchComponent<IDComponent>();
     }
 
     void SceneSerializer::serializeAudioComponent(Entity& entity, nlohmann::json& jsonEntity, ProjectData* projectData) {
@@ -6,13 +6,21 @@ namespace TWE {
         _sceneRegistry.run.physics = new ScenePhysics();
         _sceneRegistry.current = &_sceneRegistry.edit;
         _sceneState = SceneState::Edit;
+        _renderPath = RenderPath::Forward;
         _sceneAudio = std::make_unique<SceneAudio>();
+        _commandBuffer = std::make_unique<CommandBuffer>(this);
+        _sceneRegistry.edit.entityIndex.connect(_sceneRegistry.edit.entityRegistry);
+        _sceneRegistry.run.entityIndex.connect(_sceneRegistry.run.entityRegistry);
+        connectTransformHierarchy(_sceneRegistry.edit.entityRegistry);
+        connectTransformHierarchy(_sceneRegistry.run.entityRegistry);
+        _isTransformHierarchyDirty = true;
 
         _debugCamera = nullptr;
         _scriptDLLRegistry = nullptr;
         _projectData = nullptr;
         _isFocusedOnDebugCamera = true;
         _name = "Unnamed";
+        registerSystems();
     }
 
     void Scene::setDebugCamera(DebugCamera* debugCamera) {
@@ -36,21 +44,28 @@ namespace TWE {
         _sceneScripts = std::make_unique<SceneScripts>(projectData);
     }
 
+    void Scene::setRenderPath(RenderPath renderPath) {
+        _renderPath = renderPath == RenderPath::Default ? RenderPath::Forward : renderPath;
+    }
+
     void Scene::setState(SceneState state) {
         _sceneState = state;
+        _isTransformHierarchyDirty = true;
         switch (_sceneState) {
         case SceneState::Edit:
             _isFocusedOnDebugCamera = true;
+            _commandBuffer->clear();
             _sceneAudio->reset();
             _sceneRegistry.current = &_sceneRegistry.edit;
             break;
         case SceneState::Run:
             _isFocusedOnDebugCamera = false;
+            _commandBuffer->clear();
             _sceneRegistry.run.lastId = 0;
             _sceneRegistry.run.urControl.reset();
             _sceneRegistry.run.physics->reset(&_sceneRegistry.run.entityRegistry);
             _sceneScripts->reset(&_sceneRegistry.run.entityRegistry);
-            resetEntityRegistry(&_sceneRegistry.run.entityRegistry);
+            resetEntityRegistry(_sceneRegistry.run);
             copySceneState(_sceneRegistry.edit, _sceneRegistry.run);
             _sceneRegistry.current = &_sceneRegistry.run;
             _sceneAudio->startAudioOnRun(&_sceneRegistry.current->entityRegistry);
@@ -65,27 +80,15 @@ namespace TWE {
         }
     }
 
-    void Scene::setLight(const LightComponent& light, TransformComponent& transform, const glm::mat4& lightSpaceMat, const uint32_t index) {
-        _sceneRegistry.current->entityRegistry.view<MeshRendererComponent>().each([&](entt::entity entity, MeshRendererComponent& meshRendererComponent){
-            Renderer::setLight(meshRendererComponent, light, transform, index);
-            Renderer::setShadows(meshRendererComponent, lightSpaceMat, index);
-        });
-    }
-
-    void Scene::setLight(const LightComponent& light, TransformComponent& transform, const uint32_t index) {
-        _sceneRegistry.current->entityRegistry.view<MeshRendererComponent>().each([&](entt::entity entity, MeshRendererComponent& meshRendererComponent){
-            Renderer::setLight(meshRendererComponent, light, transform, index);
-        });
-    }
-
     void Scene::reset() {
         _sceneRegistry.run.physics->reset(&_sceneRegistry.run.entityRegistry);
         _sceneScripts->reset(&_sceneRegistry.run.entityRegistry);
-        resetEntityRegistry(&_sceneRegistry.run.entityRegistry);
+        resetEntityRegistry(_sceneRegistry.run);
         _sceneRegistry.edit.physics->reset(&_sceneRegistry.edit.entityRegistry);
         _sceneScripts->reset(&_sceneRegistry.edit.entityRegistry);
-        resetEntityRegistry(&_sceneRegistry.edit.entityRegistry);
+        resetEntityRegistry(_sceneRegistry.edit);
         setState(SceneState::Edit);
+        _renderPath = RenderPath::Forward;
         _sceneRegistry.run.lastId = 0;
         _sceneRegistry.edit.lastId = 0;
         _sceneRegistry.run.urControl.reset();
@@ -94,174 +97,206 @@ namespace TWE {
         Shape::reset();
     }
 
-    void Scene::resetEntityRegistry(entt::registry* registry) {
-        registry->clear();
-        *registry = {};
+    void Scene::resetEntityRegistry(SceneStateSpecification& sceneState) {
+        sceneState.entityIndex.disconnect();
+        sceneState.entityRegistry.clear();
+        sceneState.entityRegistry = {};
+        sceneState.entityIndex.connect(sceneState.entityRegistry);
+        connectTransformHierarchy(sceneState.entityRegistry);
+        _isTransformHierarchyDirty = true;
     }
 
-    void Scene::updateLight() {
-        uint32_t lightIndex = 0;
-        _sceneRegistry.current->entityRegistry.view<LightComponent, TransformComponent>()
-            .each([&](entt::entity entity, LightComponent& lightComponent, TransformComponent& transformComponent){
-                if(!lightComponent.getCastShadows()) {
-                    setLight(lightComponent, transformComponent, lightIndex++);
+    bool Scene::updateView() {
+        _sceneViews.clear();
+        _sceneCamera = {};
+        bool hasPrimaryView = false;
+        if(_isFocusedOnDebugCamera && _debugCamera)
+            setSceneCamera(_sceneCamera, _debugCamera, _debugCamera->getPosition(), _debugCamera->getForward(), _debugCamera->getUp());
+        _sceneRegistry.current->entityRegistry.view<CameraComponent, TransformComponent>()
+            .each([&](entt::entity entity, CameraComponent& cameraComponent, TransformComponent& transformComponent){
+                if(!cameraComponent.isFocusedOn())
+                    return;
+                bool hasRenderTarget = cameraComponent.hasRenderTarget();
+                if(hasRenderTarget && !cameraComponent.shouldRender())
+                    return;
+                if(!hasRenderTarget && _isFocusedOnDebugCamera)
+                    return;
+                SceneCameraSpecification sceneCamera;
+                setSceneCamera(sceneCamera, cameraComponent.getSource(), transformComponent.getPosition(), -transformComponent.getForward(), transformComponent.getUp());
+                auto renderPath = cameraComponent.getRenderPath() == RenderPath::Default ? _renderPath : cameraComponent.getRenderPath();
+                if(hasRenderTarget) {
+                    _sceneViews.emplace_back(sceneCamera, cameraComponent.getRenderTarget(), glm::vec4(0.f, 0.f, 1.f, 1.f), renderPath);
                     return;
                 }
-                glm::mat4& lightProjection = lightComponent.getLightProjection();
-                glm::mat4& lightView = glm::lookAt(transformComponent.getPosition(), {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f});
-                auto projectionView = lightProjection * lightView;
-                Renderer::generateDepthMap(lightComponent, transformComponent, lightProjection, lightView, projectionView, this);
-                setLight(lightComponent, transformComponent, projectionView, lightIndex++);
+                bool isPrimary = cameraComponent.getViewport() == glm::vec4(0.f, 0.f, 1.f, 1.f);
+                if(isPrimary && hasPrimaryView)
+                    return;
+                if(isPrimary || !_sceneCamera.camera)
+                    _sceneCamera = sceneCamera;
+                hasPrimaryView |= isPrimary;
+                _sceneViews.emplace_back(sceneCamera, nullptr, cameraComponent.getViewport(), renderPath);
             });
-    } 
+        if(_isFocusedOnDebugCamera && _sceneCamera.camera)
+            _sceneViews.emplace_back(_sceneCamera, nullptr, glm::vec4(0.f, 0.f, 1.f, 1.f), _renderPath);
+        std::stable_sort(_sceneViews.begin(), _sceneViews.end(), [](const SceneViewSpecification& first, const SceneViewSpecification& second) {
+            return getViewOrder(first) < getViewOrder(second);
+        });
+        return !_sceneViews.empty();
+    }
 
-    bool Scene::updateView() {
-        _sceneCamera.camera = nullptr;
-        _sceneCamera.position = glm::vec3(0.f);
-        _sceneCamera.forward = glm::vec3(0.f);
-        _sceneCamera.up = glm::vec3(0.f);
-        if(_isFocusedOnDebugCamera && _debugCamera) {
-            _sceneCamera.camera = _debugCamera;
-            _sceneCamera.position = _debugCamera->getPosition();
-            _sceneCamera.forward = _debugCamera->getForward();
-            _sceneCamera.up = _debugCamera->getUp();
-        }
-        else {
-            auto& camsView = _sceneRegistry.current->entityRegistry.view<TransformComponent>();
-            for(auto camEntity : camsView) {
-                Entity entity = { camEntity, this };
-                if(!entity.hasComponent<CameraComponent>())
-                    continue;
-                auto& transformComponent = entity.getComponent<TransformComponent>();
-                auto& cameraComponent = entity.getComponent<CameraComponent>();
-                if(cameraComponent.isFocusedOn()){
-                    _sceneCamera.camera = cameraComponent.getSource();
-                    _sceneCamera.position = transformComponent.getPosition();
-                    _sceneCamera.forward = -transformComponent.getForward();
-                    _sceneCamera.up = transformComponent.getUp();
-                    break;
-                }
-            }
-        }
-        if(!_sceneCamera.camera)
-            return false;
-        _sceneCamera.view = _sceneCamera.camera->getView(_sceneCamera.position, _sceneCamera.forward, _sceneCamera.up);
-        _sceneCamera.projection = _sceneCamera.camera->getProjection();
-        _sceneCamera.projectionView = _sceneCamera.projection * _sceneCamera.view;
-        return true;
+    int Scene::getViewOrder(const SceneViewSpecification& sceneView) {
+        if(sceneView.renderTarget)
+            return 0;
+        return sceneView.viewport == glm::vec4(0.f, 0.f, 1.f, 1.f) ? 1 : 2;
+    }
+
+    void Scene::setSceneCamera(SceneCameraSpecification& sceneCamera, Camera* camera, const glm::vec3& position, const glm::vec3& forward, const glm::vec3& up) {
+        sceneCamera.camera = camera;
+        sceneCamera.position = position;
+        sceneCamera.forward = forward;
+        sceneCamera.up = up;
+        sceneCamera.view = camera->getView(position, forward, up);
+        sceneCamera.projection = camera->getProjection();
+        sceneCamera.projectionView = sceneCamera.projection * sceneCamera.view;
+    }
+
+    void Scene::registerSystems() {
+        auto transformReads = SystemScheduler::types<ParentChildsComponent>();
+        auto transformWrites = SystemScheduler::types<TransformComponent, PhysicsComponent, AudioComponent, ISceneAudio>();
+        auto viewWrites = SystemScheduler::types<CameraComponent, TransformComponent, SceneCameraSpecification, SceneViewSpecification>();
+        _editSystems.add("Transforms", [this](IScene*) { updateTransforms(); }, transformReads, transformWrites);
+        _editSystems.add("View", [this](IScene*) { updateView(); }, {}, viewWrites, SystemAccess::Exclusive);
+        _runSystems.add("Physics", [this](IScene*) {
+            _sceneRegistry.current->physics->updateWorldSimulation(&_sceneRegistry.current->entityRegistry, Time::getDeltaTime());
+        }, {}, SystemScheduler::types<IScenePhysics, PhysicsComponent, TransformComponent>());
+        _runSystems.add("Scripts", [this](IScene* scene) { _sceneScripts->update(&_sceneRegistry.current->entityRegistry, scene); }, {}, {},
+            SystemAccess::Exclusive);
+        _runSystems.add("Commands", [this](IScene*) { _commandBuffer->execute(); }, {}, {}, SystemAccess::Exclusive);
+        _runSystems.add("Transforms", [this](IScene*) { updateTransforms(); }, transformReads, transformWrites);
+        _runSystems.add("Audio listener", [this](IScene*) { _sceneAudio->updateAudioListenerPosition(_sceneCamera); },
+            SystemScheduler::types<SceneCameraSpecification>(), SystemScheduler::types<ISceneAudio>());
+        _runSystems.add("Collision cleanup", [this](IScene*) { _sceneRegistry.current->physics->cleanCollisionDetection(); }, {},
+            SystemScheduler::types<IScenePhysics>());
+        _runSystems.add("View", [this](IScene*) { updateView(); }, {}, viewWrites, SystemAccess::Exclusive);
     }
 
     void Scene::updateEditState() {
-        updateTransforms();
-        if(!updateView())
-            return;
-        updateLight();
+        _editSystems.run(this);
     }
 
     void Scene::updateRunState() {
-        _sceneRegistry.current->physics->updateWorldSimulation(&_sceneRegistry.current->entityRegistry, Time::getDeltaTime());
-        _sceneScripts->update(&_sceneRegistry.current->entityRegistry, this);
-        updateTransforms();
-        _sceneAudio->updateAudioListenerPosition(_sceneCamera);
-        _sceneRegistry.current->physics->cleanCollisionDetection();
-        if(!updateView())
-            return;
-        updateLight();
+        _runSystems.run(this);
+        _commandBuffer->execute();
     }
 
     void Scene::updateTransforms() {
-        _sceneRegistry.current->entityRegistry.view<TransformComponent>().each([&](entt::entity entity, TransformComponent& transformComponent){
-            if(transformComponent.getPreTransform() == transformComponent.getTransform())
-                return;
-            auto& transform = transformComponent.getTransform();
+        if(_isTransformHierarchyDirty)
+            buildTransformHierarchy();
+        for(auto& node : _transformNodes)
+            TransformBatch::submit(*node.transformComponent);
+        TransformBatch::compute();
+        for(auto& node : _transformNodes) {
+            auto& transformComponent = *node.transformComponent;
+            auto parentNode = node.parent == -1 ? nullptr : &_transformNodes[node.parent];
+            entt::entity parent = parentNode ? parentNode->entity : entt::null;
             auto& preTransform = transformComponent.getPreTransform();
-            Entity instance = { entity, this };
-            if(!instance.hasComponent<ParentChildsComponent>())
-                return;
-            auto& parentChildsComponent = instance.getComponent<ParentChildsComponent>();
-            ModelSpecification ratioTransform(
-                transform.position - preTransform.position,
-                transform.rotation - preTransform.rotation,
-                transform.size - preTransform.size
-            );
-            for(auto& child : parentChildsComponent.childs) {
-                Entity childInstance = { child, this };
-                updateChildsTransform(childInstance, ratioTransform, transform.position);
-            }
-            if(instance.hasComponent<PhysicsComponent>()) {
-                auto& physicsComponent = instance.getComponent<PhysicsComponent>();
-                if(!physicsComponent.getNeedUpdate())
-                    physicsComponent.setNeedUpdate(true);
-                else {
-                    if(ratioTransform.position != glm::vec3(0.f))
-                        physicsComponent.setPosition(physicsComponent.getPosition() + ratioTransform.position);
-                    if(ratioTransform.rotation != glm::vec3(0.f))
-                        physicsComponent.setRotation(glm::quat(transform.rotation));
-                    if(ratioTransform.size != glm::vec3(0.f))
-                        physicsComponent.setSize(physicsComponent.getLocalScale() + ratioTransform.size);
+            glm::vec3 prePosition = preTransform.position;
+            glm::vec3 preSize = preTransform.size;
+            glm::quat preOrientation = transformComponent._preOrientation;
+            node.isChanged = true;
+            node.isPropagated = !transformComponent._keepChilds;
+            bool isPhysicsDriven = false;
+            if(transformComponent._keepChilds || transformComponent._isDirty) {
+                node.model = transformComponent.getModel();
+                transformComponent._keepChilds = false;
+                if(parentNode)
+                    transformComponent.setLocalModel(parentNode->model, parent);
+                if(node.physicsComponent && !node.physicsComponent->getNeedUpdate()) {
+                    node.physicsComponent->setNeedUpdate(true);
+                    isPhysicsDriven = true;
                 }
             }
-            if(instance.hasComponent<AudioComponent>()) {
-                auto& audioComponent = instance.getComponent<AudioComponent>();
-                auto& soundSources = audioComponent.getSoundSources();
-                for(auto soundSource : soundSources) {
-                    auto& sounds = soundSource->getSounds();
-                    for(auto sound : sounds) {
-                        irrklang::vec3df position = {transform.position.x, 
-                            transform.position.y, transform.position.z};
-                        sound->setPosition(position);
-                    }
-                }
+            else if(parentNode && parentNode->isChanged && parentNode->isPropagated && transformComponent._parent == parent) {
+                node.model = parentNode->model * transformComponent._localModel;
+                transformComponent.setWorldModel(node.model);
             }
-            transformComponent.setPreTransform(transform);
-        });
+            else {
+                node.model = transformComponent.getModel();
+                node.isChanged = false;
+                if(parentNode && (parentNode->isChanged || transformComponent._parent != parent))
+                    transformComponent.setLocalModel(parentNode->model, parent);
+                else if(!parentNode && transformComponent._parent != entt::null)
+                    transformComponent.setLocalModel(glm::mat4(1.f), entt::null);
+                continue;
+            }
+            auto& position = transformComponent.getPosition();
+            if(node.physicsComponent && !isPhysicsDriven)
+                updatePhysicsTransform(*node.physicsComponent, transformComponent, position - prePosition, transformComponent.getSize() - preSize,
+                    preOrientation != transformComponent.getOrientation());
+            if(node.audioComponent) {
+                irrklang::vec3df soundPosition = {position.x, position.y, position.z};
+                for(auto soundSource : node.audioComponent->getSoundSources())
+                    for(auto sound : soundSource->getSounds())
+                        sound->setPosition(soundPosition);
+            }
+            transformComponent.commitTransform();
+        }
     } 
 
-    void Scene::updateChildsTransform(Entity& entity, ModelSpecification& ratioTransform, const glm::vec3& centerPositon) {
-        if(!entity.hasComponent<TransformComponent>())
-            return;
-        auto& transformComponent = entity.getComponent<TransformComponent>();
-        auto& transform = transformComponent.getTransform();
-        auto& preTransform = transformComponent.getPreTransform();
-        bool hasPhysics = entity.hasComponent<PhysicsComponent>();
-        PhysicsComponent* physicsComponent;
-        if(hasPhysics)
-            physicsComponent = &entity.getComponent<PhysicsComponent>();
-        if(ratioTransform.position != glm::vec3(0.f)) {
-            transformComponent.setPosition(transform.position + ratioTransform.position);
-            if(hasPhysics)
-                physicsComponent->setPosition(physicsComponent->getPosition() + ratioTransform.position);
-        }
-        if(ratioTransform.rotation != glm::vec3(0.f)) {
-            transformComponent.rotateAroundOrigin(ratioTransform.rotation, centerPositon);
-            if(hasPhysics) {
-                physicsComponent->setRotation(glm::quat(transform.rotation));
-                physicsComponent->setPosition(transform.position);
+    void Scene::buildTransformHierarchy() {
+        auto& registry = _sceneRegistry.current->entityRegistry;
+        _transformNodes.clear();
+        _isTransformHierarchyDirty = false;
+        registry.view<TransformComponent>().each([&](entt::entity entity, TransformComponent& transformComponent){
+            auto parentChildsComponent = registry.try_get<ParentChildsComponent>(entity);
+            if(parentChildsComponent && registry.valid(parentChildsComponent->parent) && registry.any_of<TransformComponent>(parentChildsComponent->parent))
+                return;
+            _transformNodes.emplace_back(entity, -1, &transformComponent, parentChildsComponent,
+                registry.try_get<PhysicsComponent>(entity), registry.try_get<AudioComponent>(entity));
+        });
+        for(size_t i = 0; i < _transformNodes.size(); ++i) {
+            if(!_transformNodes[i].parentChildsComponent)
+                continue;
+            entt::entity entity = _transformNodes[i].entity;
+            for(auto child : _transformNodes[i].parentChildsComponent->childs) {
+                if(!registry.valid(child))
+                    continue;
+                auto transformComponent = registry.try_get<TransformComponent>(child);
+                auto parentChildsComponent = registry.try_get<ParentChildsComponent>(child);
+                if(!transformComponent || !parentChildsComponent || parentChildsComponent->parent != entity)
+                    continue;
+                _transformNodes.emplace_back(child, static_cast<int>(i), transformComponent, parentChildsComponent,
+                    registry.try_get<PhysicsComponent>(child), registry.try_get<AudioComponent>(child));
             }
         }
-        if(ratioTransform.size != glm::vec3(0.f)) {
-            transformComponent.setSize(transform.size + ratioTransform.size);
-            if(hasPhysics)
-                physicsComponent->setSize(physicsComponent->getLocalScale() + ratioTransform.size);
-        }
-        auto& parentChildsComponent = entity.getComponent<ParentChildsComponent>();
-        for(auto& child : parentChildsComponent.childs) {
-            Entity childInstance = { child, this };
-            updateChildsTransform(childInstance, ratioTransform, centerPositon);
-        }
-        if(entity.hasComponent<AudioComponent>()) {
-            auto& audioComponent = entity.getComponent<AudioComponent>();
-            auto& soundSources = audioComponent.getSoundSources();
-            for(auto soundSource : soundSources) {
-                auto& sounds = soundSource->getSounds();
-                for(auto sound : sounds) {
-                    irrklang::vec3df position = {transform.position.x, 
-                        transform.position.y, transform.position.z};
-                    sound->setPosition(position);
-                }
-            }
+    }
+
+    void Scene::connectTransformHierarchy(entt::registry& registry) {
+        registry.on_construct<TransformComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_destroy<TransformComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_construct<ParentChildsComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_update<ParentChildsComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_destroy<ParentChildsComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_construct<PhysicsComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_destroy<PhysicsComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_construct<AudioComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+        registry.on_destroy<AudioComponent>().connect<&Scene::invalidateTransformHierarchy>(*this);
+    }
+
+    void Scene::invalidateTransformHierarchy(entt::registry& registry, entt::entity entity) {
+        _isTransformHierarchyDirty = true;
+    }
+
+    void Scene::updatePhysicsTransform(PhysicsComponent& physicsComponent, const TransformComponent& transformComponent, const glm::vec3& positionDelta,
+    const glm::vec3& sizeDelta, bool isRotated) {
+        if(positionDelta != glm::vec3(0.f))
+            physicsComponent.setPosition(physicsComponent.getPosition() + positionDelta);
+        if(isRotated) {
+            physicsComponent.setRotation(transformComponent.getOrientation());
+            physicsComponent.setPosition(transformComponent.getPosition());
         }
-        transformComponent.setPreTransform(transform);
+        if(sizeDelta != glm::vec3(0.f))
+            physicsComponent.setSize(physicsComponent.getLocalScale() + sizeDelta);
     }
 
     void Scene::update() {
@@ -333,11 +368,50 @@ namespace TWE {
         return { entity, this };
     }
 
+    std::vector<Entity> Scene::createEntities(const std::vector<std::string>& names) {
+        auto& registry = _sceneRegistry.current->entityRegistry;
+        std::vector<entt::entity> entities(names.size());
+        registry.create(entities.begin(), entities.end());
+        registry.insert<TransformComponent>(entities.begin(), entities.end());
+        registry.insert<CreationTypeComponent>(entities.begin(), entities.end());
+        registry.insert<ParentChildsComponent>(entities.begin(), entities.end());
+        registry.insert<EmptyComponent>(entities.begin(), entities.end());
+        std::vector<Entity> res;
+        res.reserve(entities.size());
+        for(size_t i = 0; i < entities.size(); ++i) {
+            registry.emplace<NameComponent>(entities[i], names[i]);
+            registry.emplace<IDComponent>(entities[i], _sceneRegistry.current->lastId++);
+            res.emplace_back(entities[i], this);
+        }
+        return res;
+    }
+
     void Scene::copySceneState(SceneStateSpecification& from, SceneStateSpecification& to) {
-        auto& view = from.entityRegistry.view<EmptyComponent>();
+        auto& fromRegistry = from.entityRegistry;
+        auto& toRegistry = to.entityRegistry;
+        auto view = fromRegistry.view<EmptyComponent>();
         int size = view.size();
         for(int i = size - 1; i >= 0; --i)
-            copyEntityState(Entity{ view[i], this }, to);
+            toRegistry.create(view[i]);
+        copyComponents<TransformComponent>(fromRegistry, toRegistry);
+        copyComponents<NameComponent>(fromRegistry, toRegistry);
+        copyComponents<CreationTypeComponent>(fromRegistry, toRegistry);
+        copyComponents<ParentChildsComponent>(fromRegistry, toRegistry);
+        copyComponents<IDComponent>(fromRegistry, toRegistry);
+        copyComponents<CameraComponent>(fromRegistry, toRegistry);
+        copyComponents<LightComponent>(fromRegistry, toRegistry);
+        copyComponents<MeshComponent>(fromRegistry, toRegistry);
+        copyComponents<MeshRendererComponent>(fromRegistry, toRegistry);
+        std::map<std::string, PVoid> behaviorFactories;
+        auto scriptView = fromRegistry.view<ScriptComponent>();
+        for(int i = static_cast<int>(scriptView.size()) - 1; i >= 0; --i)
+            copyScriptComponent(fromRegistry.get<ScriptComponent>(scriptView[i]), toRegistry, scriptView[i], behaviorFactories);
+        auto physicsView = fromRegistry.view<PhysicsComponent>();
+        for(int i = static_cast<int>(physicsView.size()) - 1; i >= 0; --i)
+            copyPhysicsComponent(fromRegistry.get<PhysicsComponent>(physicsView[i]), to, physicsView[i]);
+        auto audioView = fromRegistry.view<AudioComponent>();
+        for(int i = static_cast<int>(audioView.size()) - 1; i >= 0; --i)
+            copyAudioComponent(fromRegistry.get<AudioComponent>(audioView[i]), toRegistry, audioView[i]);
     }
 
     Entity Scene::copyEntityState(Entity& entity, SceneStateSpecification& to) {
@@ -357,20 +431,8 @@ namespace TWE {
         if(entity.hasComponent<LightComponent>())
             to.entityRegistry.emplace<LightComponent>(instance, entity.getComponent<LightComponent>());
         if(entity.hasComponent<ScriptComponent>()) {
-            auto& scriptComponent = to.entityRegistry.emplace<ScriptComponent>(instance);
-            auto& scripts = entity.getComponent<ScriptComponent>().getScripts();
-            for(auto& script : scripts) {
-                auto scriptDLLData = _scriptDLLRegistry->get(script.behaviorClassName);
-                if(scriptDLLData && scriptDLLData->isValid) {
-                    auto behaviorFactory = DLLCreator::loadDLLFunc(*scriptDLLData);
-                    if(behaviorFactory) {
-                        Behavior* behavior = (Behavior*)behaviorFactory();
-                        auto scriptSpec = scriptComponent.bind(behavior, scriptDLLData->scriptName);
-                        if(scriptSpec)
-                            scriptSpec->isEnabled = script.isEnabled;
-                    }
-                }
-            }
+            std::map<std::string, PVoid> behaviorFactories;
+            copyScriptComponent(entity.getComponent<ScriptComponent>(), to.entityRegistry, instance, behaviorFactories);
         }
         if(entity.hasComponent<MeshComponent>()) {
             auto& meshComponent = entity.getComponent<MeshComponent>();
@@ -385,36 +447,59 @@ namespace TWE {
             meshRendererComponentCopy.setMaterial(meshRendererComponent.getMaterial());
             meshRendererComponentCopy.setIs3D(meshRendererComponent.getIs3D());
         }
-        if(entity.hasComponent<PhysicsComponent>()) {
-            auto& physicsComponent = entity.getComponent<PhysicsComponent>();
-            if(physicsComponent.getColliderType() != ColliderType::TriangleMesh) {
-                auto& physxComp = to.entityRegistry.emplace<PhysicsComponent>(instance, to.physics->getDynamicWorld(), physicsComponent.getColliderType(), 
-                    physicsComponent.getShapeDimensions(), physicsComponent.getLocalScale(), physicsComponent.getPosition(),
-                    physicsComponent.getRotation(), physicsComponent.getMass(), instance);
-                physxComp.setIsRotated(physicsComponent.getIsRotated());
-                physxComp.setIsTrigger(physicsComponent.getIsTrigger());
-            } else {
-                auto& physxComp = to.entityRegistry.emplace<PhysicsComponent>(instance, to.physics->getDynamicWorld(), physicsComponent.getColliderType(), 
-                    physicsComponent.getTriangleMesh(), physicsComponent.getLocalScale(), physicsComponent.getPosition(),
-                    physicsComponent.getRotation(), instance);
-                physxComp.setIsTrigger(physicsComponent.getIsTrigger());
-            }
+        if(entity.hasComponent<PhysicsComponent>())
+            copyPhysicsComponent(entity.getComponent<PhysicsComponent>(), to, instance);
+        if(entity.hasComponent<AudioComponent>())
+            copyAudioComponent(entity.getComponent<AudioComponent>(), to.entityRegistry, instance);
+        return { instance, this };
+    }
+
+    void Scene::copyScriptComponent(ScriptComponent& scriptComponent, entt::registry& to, entt::entity instance, std::map<std::string, PVoid>& behaviorFactories) {
+        auto& scriptComponentCopy = to.emplace<ScriptComponent>(instance);
+        auto& scripts = scriptComponent.getScripts();
+        for(auto& script : scripts) {
+            auto scriptDLLData = _scriptDLLRegistry->get(script.behaviorClassName);
+            if(!scriptDLLData || !scriptDLLData->isValid)
+                continue;
+            auto behaviorFactory = behaviorFactories.find(script.behaviorClassName);
+            if(behaviorFactory == behaviorFactories.end())
+                behaviorFactory = behaviorFactories.emplace(script.behaviorClassName, DLLCreator::loadDLLFunc(*scriptDLLData)).first;
+            if(!behaviorFactory->second)
+                continue;
+            Behavior* behavior = (Behavior*)behaviorFactory->second();
+            auto scriptSpec = scriptComponentCopy.bind(behavior, scriptDLLData->scriptName);
+            if(scriptSpec)
+                scriptSpec->isEnabled = script.isEnabled;
         }
-        if(entity.hasComponent<AudioComponent>()) {
-            auto& audioComponent = entity.getComponent<AudioComponent>();
-            auto& audioComponentCopy = to.entityRegistry.emplace<AudioComponent>(instance, _sceneAudio->getSoundEngine());
-            auto& soundSources = audioComponent.getSoundSources();
-            for(auto soundSource : soundSources) {
-                auto newSoundSource = audioComponentCopy.addSoundSource(soundSource->getSoundSourcePath(), soundSource->getIs3D());
-                newSoundSource->setPlayLooped(soundSource->getPlayLooped());
-                newSoundSource->setStartPaused(soundSource->getStartPaused());
-                newSoundSource->setVolume(soundSource->getVolume());
-                newSoundSource->setMinDistance(soundSource->getMinDistance());
-                newSoundSource->setMaxDistance(soundSource->getMaxDistance());
-                newSoundSource->setPlaybackSpeed(soundSource->getPlaybackSpeed());
-            }
+    }
+
+    void Scene::copyPhysicsComponent(PhysicsComponent& physicsComponent, SceneStateSpecification& to, entt::entity instance) {
+        if(physicsComponent.getColliderType() != ColliderType::TriangleMesh) {
+            auto& physxComp = to.entityRegistry.emplace<PhysicsComponent>(instance, to.physics->getDynamicWorld(), physicsComponent.getColliderType(), 
+                physicsComponent.getShapeDimensions(), physicsComponent.getLocalScale(), physicsComponent.getPosition(),
+                physicsComponent.getRotation(), physicsComponent.getMass(), instance);
+            physxComp.setIsRotated(physicsComponent.getIsRotated());
+            physxComp.setIsTrigger(physicsComponent.getIsTrigger());
+        } else {
+            auto& physxComp = to.entityRegistry.emplace<PhysicsComponent>(instance, to.physics->getDynamicWorld(), physicsComponent.getColliderType(), 
+                physicsComponent.getTriangleMesh(), physicsComponent.getLocalScale(), physicsComponent.getPosition(),
+                physicsComponent.getRotation(), instance);
+            physxComp.setIsTrigger(physicsComponent.getIsTrigger());
+        }
+    }
+
+    void Scene::copyAudioComponent(AudioComponent& audioComponent, entt::registry& to, entt::entity instance) {
+        auto& audioComponentCopy = to.emplace<AudioComponent>(instance, _sceneAudio->getSoundEngine());
+        auto& soundSources = audioComponent.getSoundSources();
+        for(auto soundSource : soundSources) {
+            auto newSoundSource = audioComponentCopy.addSoundSource(soundSource->getSoundSourcePath(), soundSource->getIs3D());
+            newSoundSource->setPlayLooped(soundSource->getPlayLooped());
+            newSoundSource->setStartPaused(soundSource->getStartPaused());
+            newSoundSource->setVolume(soundSource->getVolume());
+            newSoundSource->setMinDistance(soundSource->getMinDistance());
+            newSoundSource->setMaxDistance(soundSource->getMaxDistance());
+            newSoundSource->setPlaybackSpeed(soundSource->getPlaybackSpeed());
         }
-        return { instance, this };
     }
 
     bool Scene::getIsFocusedOnDebugCamera() const noexcept { return _isFocusedOnDebugCamera; }
@@ -429,6 +514,10 @@ namespace TWE {
     IScenePhysics* Scene::getScenePhysics() { return _sceneRegistry.current->physics; }
     ProjectData* Scene::getProjectData() { return _projectData; }
     SceneCameraSpecification* Scene::getSceneCamera() { return &_sceneCamera; }
+    std::vector<SceneViewSpecification>* Scene::getSceneViews() { return &_sceneViews; }
     SceneRegistrySpecification* Scene::getSceneRegistry() { return &_sceneRegistry; }
+    SystemScheduler* Scene::getSystemScheduler(SceneState state) { return state == SceneState::Run || state == SceneState::Unpause ? &_runSystems : &_editSystems; }
+    CommandBuffer* Scene::getCommandBuffer() { return _commandBuffer.get(); }
     SceneState Scene::getSceneState() { return _sceneState; }
+    RenderPath Scene::getRenderPath() const noexcept { return _renderPath; }
 }
\ No newline at end of file
@@ -89,6 +89,7 @@ namespace TWE {
         shapeSpec->meshRegistry->clean();
         shapeSpec->meshRendererRegistry->clean();
         shapeSpec->textureRegistry->clean();
+        AssetManager::reset();
         shapeSpec->meshCounter = 0;
         shapeSpec->textureNumber = 0;
         fillMeshRegistry();
@@ -164,6 +165,7 @@ namespace TWE {
         auto& transformComponent = entity.getComponent<TransformComponent>();
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Cube");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -187,6 +189,7 @@ namespace TWE {
         auto& transformComponent = entity.getComponent<TransformComponent>();
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Plate");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -221,6 +224,7 @@ namespace TWE {
         transformComponent.scale({1000.f, 1000.f, 1000.f});
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Cubemap");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -231,6 +235,7 @@ namespace TWE {
         entity.addComponent<LightComponent>(color, innerRadius, outerRadius, constant, linear, quadratic, LightType::Spot);
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Spot light");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -241,6 +246,7 @@ namespace TWE {
         entity.addComponent<LightComponent>(color, 15.f, 20.f, constant, linear, quadratic, LightType::Point);
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Point light");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -251,6 +257,7 @@ namespace TWE {
         entity.addComponent<LightComponent>(color, 15.f, 20.f, 1.f, 0.045f, 0.0075f, LightType::Dir);
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Dir light");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -261,6 +268,7 @@ namespace TWE {
         entity.addComponent<CameraComponent>();
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Camera");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
@@ -268,20 +276,163 @@ namespace TWE {
         try {
             ModelLoader mloader;
             auto modelLoaderData = mloader.loadModel(modelPath.string());
-            int index = 0;
-            for(auto& mesh : modelLoaderData->meshComponents){
-                std::string registryId = "Model mesh-" + std::to_string(shapeSpec->meshCounter++);
-                MeshComponent meshComponent(mesh);
-                ModelMeshSpecification modelSpec(true, modelLoaderData->fullPath, index++);
-                registerMeshSpecification(meshComponent.getVAO(), meshComponent.getVBO(), meshComponent.getEBO(), EntityCreationType::Model, registryId, modelSpec);
-            }
+            if(!mloader.getErrorString().empty())
+                std::cout << "Error model loading:\n" << mloader.getErrorString() << std::endl;
+            return registerModelData(modelLoaderData);
         } catch(const std::exception& error) {
             std::cout << error.what() << std::endl;
             return false; 
         }
+    }
+
+    void Shape::registerModels(const std::vector<std::filesystem::path>& modelPaths) {
+        std::vector<std::filesystem::path> newModelPaths;
+        for(auto& modelPath : modelPaths)
+            if(!isModelResident(modelPath) && std::find(newModelPaths.begin(), newModelPaths.end(), modelPath) == newModelPaths.end())
+                newModelPaths.push_back(modelPath);
+        size_t modelCount = newModelPaths.size();
+        std::vector<std::unique_ptr<ModelLoader>> modelLoaders;
+        std::vector<JobHandle> preparedModels;
+        std::vector<uint8_t> isPrepared(modelCount, false);
+        std::vector<std::exception_ptr> errors(modelCount);
+        for(size_t i = 0; i < modelCount; ++i) {
+            modelLoaders.push_back(std::make_unique<ModelLoader>());
+            auto modelLoader = modelLoaders.back().get();
+            auto modelPath = newModelPaths[i].string();
+            preparedModels.push_back(JobSystem::submit([modelLoader, modelPath, &isPrepared, &errors, i]() {
+                try {
+                    isPrepared[i] = modelLoader->prepareModel(modelPath);
+                } catch(...) {
+                    errors[i] = std::current_exception();
+                }
+            }));
+        }
+        for(size_t i = 0; i < modelCount; ++i) {
+            JobSystem::wait(preparedModels[i]);
+            try {
+                if(errors[i])
+                    std::rethrow_exception(errors[i]);
+                if(isPrepared[i])
+                    registerModelData(modelLoaders[i]->uploadModel());
+                else if(!modelLoaders[i]->getErrorString().empty())
+                    std::cout << "Error model loading:\n" << modelLoaders[i]->getErrorString() << std::endl;
+            } catch(const std::exception& error) {
+                std::cout << error.what() << std::endl;
+            }
+        }
+    }
+
+    bool Shape::reloadModel(IScene* scene, const std::filesystem::path& modelPath) {
+        if(!hasModel(modelPath) || !registerModel(modelPath))
+            return false;
+        auto absoluteModelPath = std::filesystem::absolute(modelPath);
+        scene->getSceneRegistry()->edit.entityRegistry.view<MeshComponent>().each([&](entt::entity entity, MeshComponent& meshComponent) {
+            auto& modelSpec = meshComponent.getModelMeshSpecification();
+            if(!modelSpec.isModel || std::filesystem::absolute(modelSpec.modelPath) != absoluteModelPath)
+                return;
+            auto meshSpecification = shapeSpec->meshRegistry->get(meshComponent.getRegistryId());
+            if(meshSpecification && meshSpecification->vbo)
+                meshComponent.setMesh(meshSpecification->vao, meshSpecification->vbo, meshSpecification->ebo, meshComponent.getRegistryId(), 
+                    meshSpecification->modelSpec);
+        });
+        return true;
+    }
+
+    bool Shape::registerModelData(ModelLoaderData* modelLoaderData) {
+        if(!modelLoaderData)
+            return false;
+        int index = 0;
+        std::vector<MeshSpecification*> meshSpecifications;
+        for(auto& mesh : modelLoaderData->meshComponents){
+            MeshComponent meshComponent(mesh);
+            MeshBoundsSpecification bounds = index < modelLoaderData->meshBounds.size() ? modelLoaderData->meshBounds[index] : MeshBoundsSpecification();
+            auto lods = index < modelLoaderData->meshLODs.size() ? modelLoaderData->meshLODs[index] : std::vector<MeshLODDataSpecification>();
+            auto& submesh = meshComponent.getModelMeshSpecification().submesh;
+            ModelMeshSpecification modelSpec(true, modelLoaderData->fullPath, index, submesh);
+            auto meshSpecification = findModelMeshSpecification(modelLoaderData->fullPath, index++);
+            if(meshSpecification) {
+                meshSpecification->vao = meshComponent.getVAO();
+                meshSpecification->vbo = meshComponent.getVBO();
+                meshSpecification->ebo = meshComponent.getEBO();
+                meshSpecification->modelSpec = modelSpec;
+            } else {
+                std::string registryId = "Model mesh-" + std::to_string(shapeSpec->meshCounter++);
+                meshSpecification = registerMeshSpecification(meshComponent.getVAO(), meshComponent.getVBO(), meshComponent.getEBO(), 
+                    EntityCreationType::Model, registryId, modelSpec);
+            }
+            meshSpecification->lodChain = createLODChain(meshComponent.getVAO(), meshComponent.getVBO(), meshComponent.getEBO(), lods, bounds);
+            meshSpecifications.push_back(meshSpecification);
+        }
+        for(auto meshSpecification : meshSpecifications)
+            meshSpecification->vbo->releaseVertices();
+        AssetManager::trackModel(modelLoaderData->fullPath, meshSpecifications);
+        delete modelLoaderData;
         return true;
     }
 
+    MeshSpecification* Shape::findModelMeshSpecification(const std::filesystem::path& modelPath, int index) {
+        auto absoluteModelPath = std::filesystem::absolute(modelPath);
+        for(auto& spec : shapeSpec->meshRegistry->getValues())
+            if(spec->modelSpec.isModel && spec->modelSpec.modelIndex == index && std::filesystem::absolute(spec->modelSpec.modelPath) == absoluteModelPath)
+                return spec;
+        return nullptr;
+    }
+
+    MeshSpecification* Shape::getMeshSpecification(const std::string& meshId) {
+        auto meshSpecification = shapeSpec->meshRegistry->get(meshId);
+        if(!meshSpecification || !meshSpecification->modelSpec.isModel)
+            return meshSpecification;
+        std::filesystem::path modelPath = meshSpecification->modelSpec.modelPath;
+        if(!meshSpecification->vbo && (!registerModel(modelPath) || !meshSpecification->vbo))
+            return nullptr;
+        AssetManager::touch(modelPath);
+        return meshSpecification;
+    }
+
+    bool Shape::hasModel(const std::filesystem::path& modelPath) {
+        auto absoluteModelPath = std::filesystem::absolute(modelPath);
+        for(auto& spec : shapeSpec->meshRegistry->getValues())
+            if(spec->modelSpec.isModel && std::filesystem::absolute(spec->modelSpec.modelPath) == absoluteModelPath)
+                return true;
+        return false;
+    }
+
+    bool Shape::isModelResident(const std::filesystem::path& modelPath) {
+        return hasModel(modelPath) && AssetManager::isResident(modelPath);
+    }
+
+    std::shared_ptr<MeshLODChainSpecification> Shape::createLODChain(std::shared_ptr<VAO> vao, std::shared_ptr<VBO> vbo, std::shared_ptr<EBO> ebo, 
+        const std::vector<MeshLODDataSpecification>& lods, const MeshBoundsSpecification& bounds) {
+        auto lodChain = std::make_shared<MeshLODChainSpecification>();
+        lodChain->lods.emplace_back(vao, ebo, 0.f);
+        lodChain->center = bounds.center;
+        lodChain->radius = bounds.radius;
+        for(auto& lod : lods) {
+            long int lodSize = lod.indexCount * (lod.indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t));
+            std::shared_ptr<VAO> lodVAO;
+            std::shared_ptr<EBO> lodEBO;
+            auto createLOD = [&]() {
+                lodVAO = std::make_shared<VAO>();
+                lodVAO->bind();
+                vbo->bind();
+                lodEBO = std::make_shared<EBO>(lod.indices, lodSize, GL_STATIC_DRAW, lod.indexType, lod.ownsIndices);
+                lodEBO->releaseIndices();
+                lodEBO->bind();
+                lodVAO->setLayout(vbo->getLayout(), *vbo.get());
+                lodVAO->unbind();
+                vbo->unbind();
+                lodEBO->unbind();
+            };
+            #if defined(TWE_BUILD) && defined(TWE_PIPELINED_RENDERING)
+            JobSystem::runOnMainThread(createLOD);
+            #else
+            createLOD();
+            #endif
+            lodChain->lods.emplace_back(lodVAO, lodEBO, lod.error);
+        }
+        return lodChain;
+    }
+
     Entity Shape::createModelEntity(IScene* scene, const std::filesystem::path& modelPath) {
         auto meshSpecs = shapeSpec->meshRegistry->getValues();
         std::string meshId;
@@ -290,9 +441,11 @@ namespace TWE {
                 meshId = spec->meshId;
                 break;
             }
-        if(meshId.empty())
+        if(meshId.empty()) {
             if(!registerModel(modelPath))
                 return {};
+        } else if(!getMeshSpecification(meshId))
+            return {};
         std::string meshRendererId = "Default renderer";
         auto meshRendererSpecification = shapeSpec->meshRendererRegistry->get(meshRendererId);
         if(!meshRendererSpecification)
@@ -300,15 +453,17 @@ namespace TWE {
         std::vector<Entity> models;
         meshSpecs = shapeSpec->meshRegistry->getValues();
         for(auto& spec : meshSpecs)
-            if(std::filesystem::absolute(spec->modelSpec.modelPath) == std::filesystem::absolute(modelPath)) {
+            if(spec->vbo && std::filesystem::absolute(spec->modelSpec.modelPath) == std::filesystem::absolute(modelPath)) {
                 Entity entity = scene->createEntity();
                 auto& creationType = entity.getComponent<CreationTypeComponent>();
                 creationType.setType(EntityCreationType::Model);
-                entity.addComponent<MeshComponent>(spec->vao, spec->vbo, spec->ebo, spec->meshId, spec->modelSpec);
+                auto& meshComponent = entity.addComponent<MeshComponent>(spec->vao, spec->vbo, spec->ebo, spec->meshId, spec->modelSpec);
+                meshComponent.setLODChain(spec->lodChain);
                 entity.addComponent<MeshRendererComponent>(meshRendererSpecification->vertexShaderPath.c_str(), 
                         meshRendererSpecification->fragmentShaderPath.c_str(), (int)entity.getSource(), meshRendererId);
                 auto& nameComponent = entity.getComponent<NameComponent>();
                 nameComponent.setName("Model");
+                entity.patchComponent<NameComponent>();
                 models.push_back(entity);
             }
         if(models.size() > 1) {
@@ -348,7 +503,7 @@ namespace TWE {
             if(meshId.empty())
                 return {};
         }
-        auto meshSpecification = shapeSpec->meshRegistry->get(meshId);
+        auto meshSpecification = getMeshSpecification(meshId);
         if(!meshSpecification)
             return {};
         std::string meshRendererId = "Default renderer";
@@ -358,11 +513,13 @@ namespace TWE {
         Entity entity = scene->createEntity();
         auto& creationType = entity.getComponent<CreationTypeComponent>();
         creationType.setType(EntityCreationType::Model);
-        entity.addComponent<MeshComponent>(meshSpecification->vao, meshSpecification->vbo, meshSpecification->ebo, meshId, meshSpecification->modelSpec);
+        auto& meshComponent = entity.addComponent<MeshComponent>(meshSpecification->vao, meshSpecification->vbo, meshSpecification->ebo, meshId, meshSpecification->modelSpec);
+        meshComponent.setLODChain(meshSpecification->lodChain);
         entity.addComponent<MeshRendererComponent>(meshRendererSpecification->vertexShaderPath.c_str(), 
                 meshRendererSpecification->fragmentShaderPath.c_str(), (int)entity.getSource(), meshRendererId);
         auto& nameComponent = entity.getComponent<NameComponent>();
         nameComponent.setName("Model");
+        entity.patchComponent<NameComponent>();
         return entity;
     }
 
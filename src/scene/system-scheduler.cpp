@@ -0,0 +1,105 @@
+#include "scene/system-scheduler.hpp"
+
+namespace TWE {
+    void SystemScheduler::add(const std::string& name, const std::function<void(IScene*)>& update, const std::vector<entt::id_type>& reads,
+    const std::vector<entt::id_type>& writes, SystemAccess access) {
+        if(_isRunning) {
+            std::lock_guard<std::mutex> lock(_pendingMutex);
+            _pendingChanges.push_back([=]() { add(name, update, reads, writes, access); });
+            return;
+        }
+        remove(name);
+        _systems.emplace_back(name, update, reads, writes, access);
+        _isDirty = true;
+    }
+
+    void SystemScheduler::remove(const std::string& name) {
+        if(_isRunning) {
+            std::lock_guard<std::mutex> lock(_pendingMutex);
+            _pendingChanges.push_back([=]() { remove(name); });
+            return;
+        }
+        auto it = std::find_if(_systems.begin(), _systems.end(), [&](const SystemSpecification& system) { return system.name == name; });
+        if(it == _systems.end())
+            return;
+        _systems.erase(it);
+        _isDirty = true;
+    }
+
+    void SystemScheduler::setIsEnabled(const std::string& name, bool isEnabled) {
+        if(_isRunning) {
+            std::lock_guard<std::mutex> lock(_pendingMutex);
+            _pendingChanges.push_back([=]() { setIsEnabled(name, isEnabled); });
+            return;
+        }
+        auto it = std::find_if(_systems.begin(), _systems.end(), [&](const SystemSpecification& system) { return system.name == name; });
+        if(it == _systems.end() || it->isEnabled == isEnabled)
+            return;
+        it->isEnabled = isEnabled;
+        _isDirty = true;
+    }
+
+    void SystemScheduler::run(IScene* scene) {
+        auto start = std::chrono::steady_clock::now();
+        if(_isDirty)
+            buildGraph();
+        _isRunning = true;
+        _jobs.assign(_systems.size(), nullptr);
+        std::vector<JobHandle> dependencies;
+        for(size_t i = 0; i < _systems.size(); ++i) {
+            auto& system = _systems[i];
+            if(!system.isEnabled)
+                continue;
+            dependencies.clear();
+            for(auto dependency : _dependencies[i])
+                dependencies.push_back(_jobs[dependency]);
+            if(system.access == SystemAccess::Exclusive) {
+                JobSystem::wait(_jobs);
+                execute(system, scene);
+                continue;
+            }
+            _jobs[i] = JobSystem::submit([&system, scene]() { execute(system, scene); }, dependencies);
+        }
+        JobSystem::wait(_jobs);
+        _isRunning = false;
+        std::vector<std::function<void()>> pendingChanges;
+        pendingChanges.swap(_pendingChanges);
+        for(auto& change : pendingChanges)
+            change();
+        _time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void SystemScheduler::buildGraph() {
+        _dependencies.assign(_systems.size(), {});
+        for(size_t i = 0; i < _systems.size(); ++i) {
+            if(!_systems[i].isEnabled)
+                continue;
+            for(size_t j = 0; j < i; ++j)
+                if(_systems[j].isEnabled && isConflicting(_systems[i], _systems[j]))
+                    _dependencies[i].push_back(j);
+        }
+        _isDirty = false;
+    }
+
+    bool SystemScheduler::isConflicting(const SystemSpecification& first, const SystemSpecification& second) {
+        if(first.access == SystemAccess::Exclusive || second.access == SystemAccess::Exclusive)
+            return true;
+        return isIntersecting(first.writes, second.writes) || isIntersecting(first.writes, second.reads) || isIntersecting(first.reads, second.writes);
+    }
+
+    bool SystemScheduler::isIntersecting(const std::vector<entt::id_type>& first, const std::vector<entt::id_type>& second) {
+        for(auto type : first)
+            if(std::find(second.begin(), second.end(), type) != second.end())
+                return true;
+        return false;
+    }
+
+    void SystemScheduler::execute(SystemSpecification& system, IScene* scene) {
+        auto start = std::chrono::steady_clock::now();
+        system.update(scene);
+        system.time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const std::vector<SystemSpecification>& SystemScheduler::getSystems() const noexcept { return _systems; }
+    float SystemScheduler::getTime() const noexcept { return _time; }
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "scene/transform-batch.hpp"
+
+namespace TWE {
+    std::vector<TransformComponent*> TransformBatch::transforms;
+    std::vector<float> TransformBatch::positions[3];
+    std::vector<float> TransformBatch::orientations[4];
+    std::vector<float> TransformBatch::sizes[3];
+    size_t TransformBatch::count = 0;
+
+    void TransformBatch::submit(TransformComponent& transformComponent) {
+        if(!transformComponent._needRecache)
+            return;
+        transforms.push_back(&transformComponent);
+        auto& position = transformComponent._transform.position;
+        auto& orientation = transformComponent._orientation;
+        auto& size = transformComponent._transform.size;
+        for(int i = 0; i < 3; ++i) {
+            positions[i].push_back(position[i]);
+            sizes[i].push_back(size[i]);
+        }
+        orientations[0].push_back(orientation.x);
+        orientations[1].push_back(orientation.y);
+        orientations[2].push_back(orientation.z);
+        orientations[3].push_back(orientation.w);
+    }
+
+    void TransformBatch::compute() {
+        count = transforms.size();
+        size_t simdEnd = 0;
+        #ifdef TWE_TRANSFORM_BATCH_SSE
+        simdEnd = count - count % 4;
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.f);
+        const __m128 two = _mm_set1_ps(2.f);
+        for(size_t i = 0; i < simdEnd; i += 4) {
+            __m128 x = _mm_loadu_ps(&orientations[0][i]);
+            __m128 y = _mm_loadu_ps(&orientations[1][i]);
+            __m128 z = _mm_loadu_ps(&orientations[2][i]);
+            __m128 w = _mm_loadu_ps(&orientations[3][i]);
+            __m128 x2 = _mm_mul_ps(x, two);
+            __m128 y2 = _mm_mul_ps(y, two);
+            __m128 z2 = _mm_mul_ps(z, two);
+            __m128 xx = _mm_mul_ps(x, x2);
+            __m128 yy = _mm_mul_ps(y, y2);
+            __m128 zz = _mm_mul_ps(z, z2);
+            __m128 xy = _mm_mul_ps(x, y2);
+            __m128 xz = _mm_mul_ps(x, z2);
+            __m128 yz = _mm_mul_ps(y, z2);
+            __m128 wx = _mm_mul_ps(w, x2);
+            __m128 wy = _mm_mul_ps(w, y2);
+            __m128 wz = _mm_mul_ps(w, z2);
+            __m128 sizeX = _mm_loadu_ps(&sizes[0][i]);
+            __m128 sizeY = _mm_loadu_ps(&sizes[1][i]);
+            __m128 sizeZ = _mm_loadu_ps(&sizes[2][i]);
+            __m128 columns[4][4] = {
+                {
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sizeX),
+                    _mm_mul_ps(_mm_add_ps(xy, wz), sizeX),
+                    _mm_mul_ps(_mm_sub_ps(xz, wy), sizeX),
+                    zero
+                },
+                {
+                    _mm_mul_ps(_mm_sub_ps(xy, wz), sizeY),
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sizeY),
+                    _mm_mul_ps(_mm_add_ps(yz, wx), sizeY),
+                    zero
+                },
+                {
+                    _mm_mul_ps(_mm_add_ps(xz, wy), sizeZ),
+                    _mm_mul_ps(_mm_sub_ps(yz, wx), sizeZ),
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sizeZ),
+                    zero
+                },
+                {
+                    _mm_loadu_ps(&positions[0][i]),
+                    _mm_loadu_ps(&positions[1][i]),
+                    _mm_loadu_ps(&positions[2][i]),
+                    one
+                }
+            };
+            for(int column = 0; column < 4; ++column) {
+                auto& rows = columns[column];
+                _MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+                for(int j = 0; j < 4; ++j)
+                    _mm_storeu_ps(&transforms[i + j]->_model[column][0], rows[j]);
+            }
+            for(int j = 0; j < 4; ++j)
+                transforms[i + j]->_needRecache = false;
+        }
+        #endif
+        computeRange(simdEnd, count);
+        transforms.clear();
+        for(auto& pool : positions)
+            pool.clear();
+        for(auto& pool : orientations)
+            pool.clear();
+        for(auto& pool : sizes)
+            pool.clear();
+    }
+
+    void TransformBatch::computeRange(size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i) {
+            float x = orientations[0][i], y = orientations[1][i], z = orientations[2][i], w = orientations[3][i];
+            float xx = 2.f * x * x, yy = 2.f * y * y, zz = 2.f * z * z;
+            float xy = 2.f * x * y, xz = 2.f * x * z, yz = 2.f * y * z;
+            float wx = 2.f * w * x, wy = 2.f * w * y, wz = 2.f * w * z;
+            auto& transformComponent = *transforms[i];
+            auto& model = transformComponent._model;
+            model[0] = glm::vec4(1.f - (yy + zz), xy + wz, xz - wy, 0.f) * sizes[0][i];
+            model[1] = glm::vec4(xy - wz, 1.f - (xx + zz), yz + wx, 0.f) * sizes[1][i];
+            model[2] = glm::vec4(xz + wy, yz - wx, 1.f - (xx + yy), 0.f) * sizes[2][i];
+            model[3] = glm::vec4(positions[0][i], positions[1][i], positions[2][i], 1.f);
+            transformComponent._needRecache = false;
+        }
+    }
+
+    size_t TransformBatch::getCount() noexcept { return count; }
+}
\ No newline at end of file
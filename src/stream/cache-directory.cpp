@@ -0,0 +1,25 @@
+#include "stream/cache-directory.hpp"
+
+namespace TWE {
+    #ifndef TWE_BUILD
+    const std::filesystem::path CacheDirectory::rootPath = "../../cache";
+    #else
+    const std::filesystem::path CacheDirectory::rootPath = "./cache";
+    #endif
+
+    std::filesystem::path CacheDirectory::getPath(const std::string& category) {
+        std::filesystem::path path = rootPath / category;
+        std::error_code error;
+        std::filesystem::create_directories(path, error);
+        return path;
+    }
+
+    std::filesystem::path CacheDirectory::getFilePath(const std::string& category, const std::string& key, const std::string& extension) {
+        uint64_t hash = 14695981039346656037ull;
+        for(char symbol : key)
+            hash = (hash ^ static_cast<uint8_t>(symbol)) * 1099511628211ull;
+        std::stringstream fileName;
+        fileName << std::hex << std::setw(16) << std::setfill('0') << hash << extension;
+        return getPath(category) / fileName.str();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include "stream/directory-model.hpp"
+
+namespace TWE {
+    const std::chrono::milliseconds DirectoryModel::rescanInterval = std::chrono::milliseconds(1000);
+
+    void DirectoryModel::setRootPath(const std::filesystem::path& rootPath) {
+        _rootPath = rootPath;
+        _directories.clear();
+        _watcher.watch(rootPath);
+        _lastRescan = std::chrono::steady_clock::now();
+    }
+
+    std::vector<FileWatchEventSpecification> DirectoryModel::update() {
+        if(!_watcher.isWatching()) {
+            auto now = std::chrono::steady_clock::now();
+            if(now - _lastRescan >= rescanInterval) {
+                _lastRescan = now;
+                _directories.clear();
+            }
+            return {};
+        }
+        auto events = _watcher.poll();
+        for(auto& event : events) {
+            switch(event.type) {
+            case FileWatchEventType::Created:
+                insert(event.path);
+                break;
+            case FileWatchEventType::Removed:
+                erase(event.path);
+                break;
+            case FileWatchEventType::Renamed:
+                erase(event.oldPath);
+                insert(event.path);
+                break;
+            case FileWatchEventType::Rescan:
+                _directories.clear();
+                break;
+            default:
+                break;
+            }
+        }
+        return events;
+    }
+
+    void DirectoryModel::invalidate() {
+        _directories.clear();
+    }
+
+    const std::vector<DirectoryEntrySpecification>& DirectoryModel::getEntries(const std::filesystem::path& directory) {
+        auto key = getKey(directory);
+        auto directoryIt = _directories.find(key);
+        if(directoryIt != _directories.end())
+            return directoryIt->second;
+        auto& entries = _directories[key];
+        std::error_code error;
+        for(auto it = std::filesystem::directory_iterator(directory, error); !error && it != std::filesystem::directory_iterator(); it.increment(error))
+            entries.emplace_back(it->path().filename().string(), it->is_directory(error));
+        std::sort(entries.begin(), entries.end(), compareEntries);
+        return entries;
+    }
+
+    void DirectoryModel::insert(const std::filesystem::path& path) {
+        auto directoryIt = _directories.find(getKey(path).parent_path());
+        if(directoryIt == _directories.end())
+            return;
+        auto& entries = directoryIt->second;
+        std::string fileName = path.filename().string();
+        if(std::find_if(entries.begin(), entries.end(), [&](const DirectoryEntrySpecification& entry) { return entry.fileName == fileName; }) != entries.end())
+            return;
+        std::error_code error;
+        DirectoryEntrySpecification entry(fileName, std::filesystem::is_directory(path, error));
+        entries.insert(std::upper_bound(entries.begin(), entries.end(), entry, compareEntries), entry);
+    }
+
+    void DirectoryModel::erase(const std::filesystem::path& path) {
+        auto key = getKey(path);
+        auto directoryIt = _directories.find(key.parent_path());
+        if(directoryIt != _directories.end()) {
+            auto& entries = directoryIt->second;
+            std::string fileName = key.filename().string();
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const DirectoryEntrySpecification& entry) {
+                return entry.fileName == fileName;
+            }), entries.end());
+        }
+        for(auto it = _directories.lower_bound(key); it != _directories.end();) {
+            auto relativePath = it->first.lexically_relative(key);
+            if(relativePath.empty() || *relativePath.begin() == "..")
+                break;
+            it = _directories.erase(it);
+        }
+    }
+
+    std::filesystem::path DirectoryModel::getKey(const std::filesystem::path& path) {
+        auto key = std::filesystem::absolute(path).lexically_normal();
+        return key.has_filename() ? key : key.parent_path();
+    }
+
+    bool DirectoryModel::compareEntries(const DirectoryEntrySpecification& left, const DirectoryEntrySpecification& right) {
+        if(left.isDirectory != right.isDirectory)
+            return left.isDirectory;
+        return left.fileName < right.fileName;
+    }
+
+    const std::filesystem::path& DirectoryModel::getRootPath() const noexcept { return _rootPath; }
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "stream/file-watcher.hpp"
+
+namespace TWE {
+    FileWatcher::~FileWatcher() {
+        stop();
+    }
+
+    bool FileWatcher::watch(const std::filesystem::path& rootPath) {
+        stop();
+        _rootPath = rootPath;
+        #ifdef TWE_PLATFORM_WINDOWS
+        _directory = CreateFileW(rootPath.wstring().c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+            OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if(_directory == INVALID_HANDLE_VALUE)
+            return false;
+        _overlapped = {};
+        _overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        _buffer.resize(16 * 1024);
+        if(!_overlapped.hEvent || !read()) {
+            stop();
+            return false;
+        }
+        return true;
+        #elif defined(__linux__)
+        _file = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if(_file < 0)
+            return false;
+        _buffer.resize(64 * 1024);
+        addWatches(rootPath, nullptr);
+        return true;
+        #else
+        return false;
+        #endif
+    }
+
+    void FileWatcher::stop() {
+        #ifdef TWE_PLATFORM_WINDOWS
+        if(_directory != INVALID_HANDLE_VALUE) {
+            if(_isPending) {
+                CancelIoEx(_directory, &_overlapped);
+                DWORD bytes;
+                GetOverlappedResult(_directory, &_overlapped, &bytes, TRUE);
+            }
+            CloseHandle(_directory);
+        }
+        if(_overlapped.hEvent)
+            CloseHandle(_overlapped.hEvent);
+        _directory = INVALID_HANDLE_VALUE;
+        _overlapped = {};
+        _isPending = false;
+        #elif defined(__linux__)
+        if(_file >= 0)
+            close(_file);
+        _file = -1;
+        _watches.clear();
+        #endif
+    }
+
+    std::vector<FileWatchEventSpecification> FileWatcher::poll() {
+        std::vector<FileWatchEventSpecification> events;
+        #ifdef TWE_PLATFORM_WINDOWS
+        if(!_isPending)
+            return events;
+        DWORD bytes = 0;
+        if(!GetOverlappedResult(_directory, &_overlapped, &bytes, FALSE)) {
+            if(GetLastError() == ERROR_IO_INCOMPLETE)
+                return events;
+            bytes = 0;
+        }
+        _isPending = false;
+        if(bytes == 0)
+            events.emplace_back(FileWatchEventType::Rescan, _rootPath);
+        else {
+            std::filesystem::path oldPath;
+            auto data = reinterpret_cast<const uint8_t*>(_buffer.data());
+            while(true) {
+                auto info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(data);
+                std::filesystem::path path = _rootPath / std::wstring(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                switch(info->Action) {
+                case FILE_ACTION_ADDED:
+                    events.emplace_back(FileWatchEventType::Created, path);
+                    break;
+                case FILE_ACTION_REMOVED:
+                    events.emplace_back(FileWatchEventType::Removed, path);
+                    break;
+                case FILE_ACTION_MODIFIED:
+                    events.emplace_back(FileWatchEventType::Modified, path);
+                    break;
+                case FILE_ACTION_RENAMED_OLD_NAME:
+                    oldPath = path;
+                    break;
+                case FILE_ACTION_RENAMED_NEW_NAME:
+                    events.emplace_back(FileWatchEventType::Renamed, path, oldPath);
+                    break;
+                default:
+                    break;
+                }
+                if(info->NextEntryOffset == 0)
+                    break;
+                data += info->NextEntryOffset;
+            }
+        }
+        ResetEvent(_overlapped.hEvent);
+        read();
+        #elif defined(__linux__)
+        if(_file < 0)
+            return events;
+        std::map<uint32_t, std::filesystem::path> movedPaths;
+        while(true) {
+            ssize_t size = ::read(_file, _buffer.data(), _buffer.size());
+            if(size <= 0)
+                break;
+            for(ssize_t offset = 0; offset < size;) {
+                auto event = reinterpret_cast<const inotify_event*>(_buffer.data() + offset);
+                offset += sizeof(inotify_event) + event->len;
+                if(event->mask & IN_Q_OVERFLOW) {
+                    events.emplace_back(FileWatchEventType::Rescan, _rootPath);
+                    continue;
+                }
+                auto watch = _watches.find(event->wd);
+                if(watch == _watches.end())
+                    continue;
+                if(event->mask & IN_IGNORED) {
+                    _watches.erase(watch);
+                    continue;
+                }
+                std::filesystem::path path = event->len > 0 ? watch->second / event->name : watch->second;
+                bool isDirectory = event->mask & IN_ISDIR;
+                if(event->mask & IN_CREATE) {
+                    events.emplace_back(FileWatchEventType::Created, path);
+                    if(isDirectory)
+                        addWatches(path, &events);
+                } else if(event->mask & IN_DELETE)
+                    events.emplace_back(FileWatchEventType::Removed, path);
+                else if(event->mask & IN_CLOSE_WRITE)
+                    events.emplace_back(FileWatchEventType::Modified, path);
+                else if(event->mask & IN_MOVED_FROM)
+                    movedPaths[event->cookie] = path;
+                else if(event->mask & IN_MOVED_TO) {
+                    auto movedPath = movedPaths.find(event->cookie);
+                    if(movedPath == movedPaths.end()) {
+                        events.emplace_back(FileWatchEventType::Created, path);
+                        if(isDirectory)
+                            addWatches(path, &events);
+                    } else {
+                        events.emplace_back(FileWatchEventType::Renamed, path, movedPath->second);
+                        if(isDirectory)
+                            moveWatches(movedPath->second, path);
+                        movedPaths.erase(movedPath);
+                    }
+                }
+            }
+        }
+        for(auto& [cookie, path] : movedPaths) {
+            events.emplace_back(FileWatchEventType::Removed, path);
+            removeWatches(path);
+        }
+        #endif
+        return events;
+    }
+
+    #ifdef TWE_PLATFORM_WINDOWS
+    bool FileWatcher::read() {
+        _isPending = ReadDirectoryChangesW(_directory, _buffer.data(), static_cast<DWORD>(_buffer.size() * sizeof(DWORD)), TRUE,
+            FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE, nullptr, &_overlapped, nullptr);
+        return _isPending;
+    }
+    #elif defined(__linux__)
+    void FileWatcher::addWatch(const std::filesystem::path& directory) {
+        int watch = inotify_add_watch(_file, directory.string().c_str(), IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO);
+        if(watch >= 0)
+            _watches[watch] = directory;
+    }
+
+    void FileWatcher::addWatches(const std::filesystem::path& directory, std::vector<FileWatchEventSpecification>* events) {
+        addWatch(directory);
+        std::error_code error;
+        for(auto it = std::filesystem::recursive_directory_iterator(directory, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+            bool isDirectory = it->is_directory(error);
+            if(isDirectory)
+                addWatch(it->path());
+            if(events)
+                events->emplace_back(FileWatchEventType::Created, it->path());
+        }
+    }
+
+    void FileWatcher::moveWatches(const std::filesystem::path& oldPath, const std::filesystem::path& newPath) {
+        for(auto& [watch, path] : _watches) {
+            auto relativePath = path.lexically_relative(oldPath);
+            if(relativePath.empty() || *relativePath.begin() == "..")
+                continue;
+            path = relativePath == "." ? newPath : newPath / relativePath;
+        }
+    }
+
+    void FileWatcher::removeWatches(const std::filesystem::path& directory) {
+        for(auto it = _watches.begin(); it != _watches.end();) {
+            auto relativePath = it->second.lexically_relative(directory);
+            if(relativePath.empty() || *relativePath.begin() == "..") {
+                ++it;
+                continue;
+            }
+            inotify_rm_watch(_file, it->first);
+            it = _watches.erase(it);
+        }
+    }
+    #endif
+
+    bool FileWatcher::isWatching() const noexcept {
+        #ifdef TWE_PLATFORM_WINDOWS
+        return _directory != INVALID_HANDLE_VALUE;
+        #elif defined(__linux__)
+        return _file >= 0;
+        #else
+        return false;
+        #endif
+    }
+
+    const std::filesystem::path& FileWatcher::getRootPath() const noexcept { return _rootPath; }
+}
\ No newline at end of file
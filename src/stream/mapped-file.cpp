@@ -0,0 +1,74 @@
+#include "stream/mapped-file.hpp"
+
+namespace TWE {
+    MappedFile::MappedFile(const std::filesystem::path& filePath) {
+        open(filePath);
+    }
+
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    bool MappedFile::open(const std::filesystem::path& filePath) {
+        close();
+        #ifdef TWE_PLATFORM_WINDOWS
+        _file = CreateFileW(filePath.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if(_file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER fileSize;
+        if(!GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0) {
+            close();
+            return false;
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(!_mapping) {
+            close();
+            return false;
+        }
+        _data = static_cast<const uint8_t*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        #else
+        _file = ::open(filePath.string().c_str(), O_RDONLY);
+        if(_file < 0)
+            return false;
+        struct stat fileStat;
+        if(fstat(_file, &fileStat) != 0 || fileStat.st_size == 0) {
+            close();
+            return false;
+        }
+        _size = static_cast<size_t>(fileStat.st_size);
+        void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+        _data = data == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(data);
+        #endif
+        if(!_data) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void MappedFile::close() {
+        #ifdef TWE_PLATFORM_WINDOWS
+        if(_data)
+            UnmapViewOfFile(_data);
+        if(_mapping)
+            CloseHandle(_mapping);
+        if(_file != INVALID_HANDLE_VALUE)
+            CloseHandle(_file);
+        _mapping = nullptr;
+        _file = INVALID_HANDLE_VALUE;
+        #else
+        if(_data)
+            munmap(const_cast<uint8_t*>(_data), _size);
+        if(_file >= 0)
+            ::close(_file);
+        _file = -1;
+        #endif
+        _data = nullptr;
+        _size = 0;
+    }
+
+    bool MappedFile::isOpen() const noexcept { return _data != nullptr; }
+    const uint8_t* MappedFile::getData() const noexcept { return _data; }
+    size_t MappedFile::getSize() const noexcept { return _size; }
+}
\ No newline at end of file
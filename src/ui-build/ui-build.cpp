@@ -10,9 +10,12 @@ namespace TWE {
         ImGui::StyleColorsDark();
         ImGui_ImplGlfw_InitForOpenGL(window, true);
         ImGui_ImplOpenGL3_Init("#version 330");
+        ImGui_ImplOpenGL3_CreateDeviceObjects();
     }
 
     UIBuild::~UIBuild() {
+        releaseDrawLists(_frames[0]);
+        releaseDrawLists(_frames[1]);
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
@@ -20,12 +23,45 @@ namespace TWE {
 
     void UIBuild::begin() {
         ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
-        ImGui::NewFrame();
+        newFrame();
     }
 
     void UIBuild::end() {
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
     }
+
+    void UIBuild::newFrame() {
+        ImGui_ImplGlfw_NewFrame();
+        ImGui::NewFrame();
+    }
+
+    void UIBuild::capture(int index) {
+        ImGui::Render();
+        auto drawData = ImGui::GetDrawData();
+        auto& frame = _frames[index];
+        releaseDrawLists(frame);
+        for(int i = 0; i < drawData->CmdListsCount; ++i)
+            frame.drawLists.push_back(drawData->CmdLists[i]->CloneOutput());
+        frame.drawData = *drawData;
+        #if IMGUI_VERSION_NUM >= 18980
+        frame.drawData.CmdLists.resize(0);
+        for(auto drawList : frame.drawLists)
+            frame.drawData.CmdLists.push_back(drawList);
+        #else
+        frame.drawData.CmdLists = frame.drawLists.data();
+        #endif
+    }
+
+    void UIBuild::render(int index) {
+        ImGui_ImplOpenGL3_NewFrame();
+        ImGui_ImplOpenGL3_RenderDrawData(&_frames[index].drawData);
+    }
+
+    void UIBuild::releaseDrawLists(UIDrawDataSpecification& frame) {
+        for(auto drawList : frame.drawLists)
+            IM_DELETE(drawList);
+        frame.drawLists.clear();
+        frame.drawData.Clear();
+    }
 }
\ No newline at end of file
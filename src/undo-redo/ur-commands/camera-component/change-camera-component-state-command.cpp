@@ -10,6 +10,9 @@ namespace TWE {
         auto& cameraComponent = _entity.getComponent<CameraComponent>();
         cameraComponent.setSource(*_newState.getSource());
         cameraComponent.setFocuse(_newState.isFocusedOn());
+        cameraComponent.setRenderTargetSpecification(_newState.getRenderTargetSpecification());
+        cameraComponent.setViewport(_newState.getViewport());
+        cameraComponent.setRenderPath(_newState.getRenderPath());
     }
 
     void ChangeCameraComponentStateCommand::unExecute() {
@@ -18,5 +21,8 @@ namespace TWE {
         auto& cameraComponent = _entity.getComponent<CameraComponent>();
         cameraComponent.setSource(*_oldState.getSource());
         cameraComponent.setFocuse(_oldState.isFocusedOn());
+        cameraComponent.setRenderTargetSpecification(_oldState.getRenderTargetSpecification());
+        cameraComponent.setViewport(_oldState.getViewport());
+        cameraComponent.setRenderPath(_oldState.getRenderPath());
     }
 }
\ No newline at end of file
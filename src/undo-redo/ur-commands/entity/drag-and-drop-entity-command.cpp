@@ -25,6 +25,8 @@ namespace TWE {
             _to.getComponent<ParentChildsComponent>().childs.push_back(_entity.getSource());
         } else if(_entity.hasComponent<ParentChildsComponent>())
             _entity.getComponent<ParentChildsComponent>().parent = entt::null;
+        if(_entity.hasComponent<ParentChildsComponent>())
+            _entity.patchComponent<ParentChildsComponent>();
     }
 
     void DragAndDropEntityCommand::unExecute() {
@@ -32,6 +34,7 @@ namespace TWE {
             _entity.getComponent<ParentChildsComponent>().parent = _preParent.getSource();
             if(_preParent.getSource() != entt::null && _preParent.hasComponent<ParentChildsComponent>())
                 _preParent.getComponent<ParentChildsComponent>().childs.push_back(_entity.getSource());
+            _entity.patchComponent<ParentChildsComponent>();
             return;
         }
         if(!_to.hasComponent<ParentChildsComponent>())
@@ -42,6 +45,7 @@ namespace TWE {
         });
         if(itChild != childs.end())
             childs.erase(itChild);
+        _to.patchComponent<ParentChildsComponent>();
         if(!_entity.hasComponent<ParentChildsComponent>())
             return;
         _entity.getComponent<ParentChildsComponent>().parent = _preParent.getSource();
@@ -11,6 +11,7 @@ namespace TWE {
             return;
         auto& nameComponent = _entity.getComponent<NameComponent>();
         nameComponent.setName(_newState.getName());
+        _entity.patchComponent<NameComponent>();
     }
 
     void ChangeNameComponentStateCommand::unExecute() {
@@ -18,5 +19,6 @@ namespace TWE {
             return;
         auto& nameComponent = _entity.getComponent<NameComponent>();
         nameComponent.setName(_oldState.getName());
+        _entity.patchComponent<NameComponent>();
     }
 }
\ No newline at end of file
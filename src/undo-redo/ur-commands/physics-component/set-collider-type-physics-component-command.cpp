@@ -12,7 +12,7 @@ namespace TWE {
         if(_newColliderType == ColliderType::TriangleMesh) {
             if(_entity.hasComponent<MeshComponent>()) {
                 auto meshSpecification = Shape::shapeSpec->meshRegistry->get(_entity.getComponent<MeshComponent>().getRegistryId());
-                physicsComponent.setColliderType(_newColliderType, TriangleMeshSpecification{meshSpecification->vbo, meshSpecification->ebo});
+                physicsComponent.setColliderType(_newColliderType, TriangleMeshSpecification{meshSpecification->vbo, meshSpecification->ebo, meshSpecification->modelSpec.submesh});
                 physicsComponent.setSize(_localScale);
             }
         } else
@@ -26,7 +26,7 @@ namespace TWE {
         if(_oldColliderType == ColliderType::TriangleMesh) {
             if(_entity.hasComponent<MeshComponent>()) {
                 auto meshSpecification = Shape::shapeSpec->meshRegistry->get(_entity.getComponent<MeshComponent>().getRegistryId());
-                physicsComponent.setColliderType(_oldColliderType, TriangleMeshSpecification{meshSpecification->vbo, meshSpecification->ebo});
+                physicsComponent.setColliderType(_oldColliderType, TriangleMeshSpecification{meshSpecification->vbo, meshSpecification->ebo, meshSpecification->modelSpec.submesh});
                 physicsComponent.setSize(_localScale);
             }
         } else